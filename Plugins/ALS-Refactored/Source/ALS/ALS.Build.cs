@@ -8,7 +8,7 @@ public class ALS : ModuleRules
 
 		PrivateDependencyModuleNames.AddRange(new[]
 		{
-			"Core", "CoreUObject", "Engine", "NetCore", "PhysicsCore", "GameplayTags", "AnimGraphRuntime", "ControlRig", "RigVM", "Niagara"
+			"Core", "CoreUObject", "Engine", "NetCore", "PhysicsCore", "Chaos", "GameplayTags", "AnimGraphRuntime", "ControlRig", "RigVM", "Niagara"
 		});
 	}
 }
\ No newline at end of file
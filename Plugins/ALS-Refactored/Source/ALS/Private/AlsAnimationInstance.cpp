@@ -1,7 +1,8 @@
 #include "AlsAnimationInstance.h"
 
+#include "AlsAnimationInstanceProxy.h"
 #include "AlsCharacter.h"
-#include "Animation/AnimInstanceProxy.h"
+#include "AlsPhysicsQuerySubsystem.h"
 #include "Components/CapsuleComponent.h"
 #include "Curves/CurveFloat.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -9,8 +10,29 @@
 #include "Utility/AlsConstants.h"
 #include "Utility/AlsLog.h"
 #include "Utility/AlsMacros.h"
+#include "Utility/AlsTrace.h"
 #include "Utility/AlsUtility.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Foot Ik Sync Traces"), STAT_AlsFootIkSyncTraces, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Foot Ik Async Traces"), STAT_AlsFootIkAsyncTraces, STATGROUP_Als)
+
+namespace AlsAnimationInstance
+{
+	static EAlsSignificance GetSignificance(const AAlsCharacter* Character)
+	{
+		return IsValid(Character) ? Character->GetSignificanceState().Significance : EAlsSignificance::Critical;
+	}
+
+	static void RefreshFootTarget(FAlsFootState& FootState, const FTransform& ComponentSpaceTransform,
+	                              const FTransform& ComponentTransform)
+	{
+		const auto TargetTransform{ComponentSpaceTransform * ComponentTransform};
+
+		FootState.TargetLocation = TargetTransform.GetLocation();
+		FootState.TargetRotation = TargetTransform.GetRotation();
+	}
+}
+
 UAlsAnimationInstance::UAlsAnimationInstance()
 {
 	RootMotionMode = ERootMotionMode::RootMotionFromMontagesOnly;
@@ -30,6 +52,54 @@ void UAlsAnimationInstance::NativeInitializeAnimation()
 		Character = GetMutableDefault<AAlsCharacter>();
 	}
 #endif
+
+	// The order of curve names must match the EAlsAnimationCurve enumeration.
+
+	const FName CurveNames[]
+	{
+		UAlsConstants::LayerHeadCurve(),
+		UAlsConstants::LayerHeadAdditiveCurve(),
+		UAlsConstants::LayerHeadSlotCurve(),
+		UAlsConstants::LayerArmLeftCurve(),
+		UAlsConstants::LayerArmLeftAdditiveCurve(),
+		UAlsConstants::LayerArmLeftSlotCurve(),
+		UAlsConstants::LayerArmLeftLocalSpaceCurve(),
+		UAlsConstants::LayerArmRightCurve(),
+		UAlsConstants::LayerArmRightAdditiveCurve(),
+		UAlsConstants::LayerArmRightSlotCurve(),
+		UAlsConstants::LayerArmRightLocalSpaceCurve(),
+		UAlsConstants::LayerHandLeftCurve(),
+		UAlsConstants::LayerHandRightCurve(),
+		UAlsConstants::LayerSpineCurve(),
+		UAlsConstants::LayerSpineAdditiveCurve(),
+		UAlsConstants::LayerSpineSlotCurve(),
+		UAlsConstants::LayerPelvisCurve(),
+		UAlsConstants::LayerPelvisSlotCurve(),
+		UAlsConstants::LayerLegsCurve(),
+		UAlsConstants::LayerLegsSlotCurve(),
+		UAlsConstants::PoseGroundedCurve(),
+		UAlsConstants::PoseInAirCurve(),
+		UAlsConstants::PoseStandingCurve(),
+		UAlsConstants::PoseCrouchingCurve(),
+		UAlsConstants::PoseMovingCurve(),
+		UAlsConstants::PoseGaitCurve(),
+		UAlsConstants::ViewBlockCurve(),
+		UAlsConstants::AllowAimingCurve(),
+		UAlsConstants::SprintBlockCurve(),
+		UAlsConstants::HipsDirectionLockCurve(),
+		UAlsConstants::GroundPredictionBlockCurve(),
+		UAlsConstants::FootLeftIkCurve(),
+		UAlsConstants::FootLeftLockCurve(),
+		UAlsConstants::FootRightIkCurve(),
+		UAlsConstants::FootRightLockCurve(),
+		UAlsConstants::FootPlantedCurve(),
+		UAlsConstants::FeetCrossingCurve(),
+		UAlsConstants::AllowTransitionsCurve()
+	};
+
+	static_assert(UE_ARRAY_COUNT(CurveNames) == static_cast<uint8>(EAlsAnimationCurve::Count));
+
+	CurveCache.Initialize(CurveNames);
 }
 
 void UAlsAnimationInstance::NativeBeginPlay()
@@ -53,10 +123,21 @@ void UAlsAnimationInstance::NativeBeginPlay()
 	}
 }
 
+FAnimInstanceProxy* UAlsAnimationInstance::CreateAnimInstanceProxy()
+{
+	return new FAlsAnimationInstanceProxy{this};
+}
+
+void UAlsAnimationInstance::DestroyAnimInstanceProxy(FAnimInstanceProxy* Proxy)
+{
+	delete static_cast<FAlsAnimationInstanceProxy*>(Proxy);
+}
+
 void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::NativeUpdateAnimation()"),
 	                            STAT_UAlsAnimationInstance_NativeUpdateAnimation, STATGROUP_Als)
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_NativeUpdateAnimation)
 
 	Super::NativeUpdateAnimation(DeltaTime);
 
@@ -84,10 +165,16 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 
 	bTeleported |= Character->IsSimulatedProxyTeleported();
 
+	// Read all curves at once, since nothing can change them until the next animation evaluation.
+
+	CurveCache.Refresh(this);
+
 #if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
 	bDisplayDebugTraces = UAlsUtility::ShouldDisplayDebug(Character, UAlsConstants::TracesDisplayName());
 #endif
 
+	CompiledState = Character->GetCompiledState();
+
 	ViewMode = Character->GetViewMode();
 	LocomotionMode = Character->GetLocomotionMode();
 	RotationMode = Character->GetRotationMode();
@@ -117,6 +204,7 @@ void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTim
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsAnimationInstance::NativeThreadSafeUpdateAnimation()"),
 	                            STAT_UAlsAnimationInstance_NativeThreadSafeUpdateAnimation, STATGROUP_Als)
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_NativeThreadSafeUpdateAnimation)
 
 	Super::NativeThreadSafeUpdateAnimation(DeltaTime);
 
@@ -173,51 +261,55 @@ void UAlsAnimationInstance::NativePostEvaluateAnimation()
 
 void UAlsAnimationInstance::RefreshLayering()
 {
-	LayeringState.HeadBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerHeadCurve());
-	LayeringState.HeadAdditiveBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerHeadAdditiveCurve());
-	LayeringState.HeadSlotBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerHeadSlotCurve());
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshLayering)
+
+	LayeringState.HeadBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerHead);
+	LayeringState.HeadAdditiveBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerHeadAdditive);
+	LayeringState.HeadSlotBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerHeadSlot);
 
 	// The mesh space blend will always be 1 unless the local space blend is 1.
 
-	LayeringState.ArmLeftBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmLeftCurve());
-	LayeringState.ArmLeftAdditiveBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmLeftAdditiveCurve());
-	LayeringState.ArmLeftSlotBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmLeftSlotCurve());
-	LayeringState.ArmLeftLocalSpaceBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmLeftLocalSpaceCurve());
+	LayeringState.ArmLeftBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerArmLeft);
+	LayeringState.ArmLeftAdditiveBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerArmLeftAdditive);
+	LayeringState.ArmLeftSlotBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerArmLeftSlot);
+	LayeringState.ArmLeftLocalSpaceBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerArmLeftLocalSpace);
 	LayeringState.ArmLeftMeshSpaceBlendAmount = !FAnimWeight::IsFullWeight(LayeringState.ArmLeftLocalSpaceBlendAmount);
 
 	// The mesh space blend will always be 1 unless the local space blend is 1.
 
-	LayeringState.ArmRightBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmRightCurve());
-	LayeringState.ArmRightAdditiveBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmRightAdditiveCurve());
-	LayeringState.ArmRightSlotBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmRightSlotCurve());
-	LayeringState.ArmRightLocalSpaceBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerArmRightLocalSpaceCurve());
+	LayeringState.ArmRightBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerArmRight);
+	LayeringState.ArmRightAdditiveBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerArmRightAdditive);
+	LayeringState.ArmRightSlotBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerArmRightSlot);
+	LayeringState.ArmRightLocalSpaceBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerArmRightLocalSpace);
 	LayeringState.ArmRightMeshSpaceBlendAmount = !FAnimWeight::IsFullWeight(LayeringState.ArmRightLocalSpaceBlendAmount);
 
-	LayeringState.HandLeftBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerHandLeftCurve());
-	LayeringState.HandRightBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerHandRightCurve());
+	LayeringState.HandLeftBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerHandLeft);
+	LayeringState.HandRightBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerHandRight);
 
-	LayeringState.SpineBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerSpineCurve());
-	LayeringState.SpineAdditiveBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerSpineAdditiveCurve());
-	LayeringState.SpineSlotBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerSpineSlotCurve());
+	LayeringState.SpineBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerSpine);
+	LayeringState.SpineAdditiveBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerSpineAdditive);
+	LayeringState.SpineSlotBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerSpineSlot);
 
-	LayeringState.PelvisBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerPelvisCurve());
-	LayeringState.PelvisSlotBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerPelvisSlotCurve());
+	LayeringState.PelvisBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerPelvis);
+	LayeringState.PelvisSlotBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerPelvisSlot);
 
-	LayeringState.LegsBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerLegsCurve());
-	LayeringState.LegsSlotBlendAmount = GetCurveValueClamped01(UAlsConstants::LayerLegsSlotCurve());
+	LayeringState.LegsBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerLegs);
+	LayeringState.LegsSlotBlendAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::LayerLegsSlot);
 }
 
 void UAlsAnimationInstance::RefreshPose()
 {
-	PoseState.GroundedAmount = GetCurveValueClamped01(UAlsConstants::PoseGroundedCurve());
-	PoseState.InAirAmount = GetCurveValueClamped01(UAlsConstants::PoseInAirCurve());
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshPose)
 
-	PoseState.StandingAmount = GetCurveValueClamped01(UAlsConstants::PoseStandingCurve());
-	PoseState.CrouchingAmount = GetCurveValueClamped01(UAlsConstants::PoseCrouchingCurve());
+	PoseState.GroundedAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::PoseGrounded);
+	PoseState.InAirAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::PoseInAir);
 
-	PoseState.MovingAmount = GetCurveValueClamped01(UAlsConstants::PoseMovingCurve());
+	PoseState.StandingAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::PoseStanding);
+	PoseState.CrouchingAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::PoseCrouching);
 
-	PoseState.GaitAmount = FMath::Clamp(GetCurveValue(UAlsConstants::PoseGaitCurve()), 0.0f, 3.0f);
+	PoseState.MovingAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::PoseMoving);
+
+	PoseState.GaitAmount = FMath::Clamp(GetCachedCurveValue(EAlsAnimationCurve::PoseGait), 0.0f, 3.0f);
 	PoseState.GaitWalkingAmount = UAlsMath::Clamp01(PoseState.GaitAmount);
 	PoseState.GaitRunningAmount = UAlsMath::Clamp01(PoseState.GaitAmount - 1.0f);
 	PoseState.GaitSprintingAmount = UAlsMath::Clamp01(PoseState.GaitAmount - 2.0f);
@@ -236,6 +328,8 @@ void UAlsAnimationInstance::RefreshPose()
 
 void UAlsAnimationInstance::RefreshViewGameThread()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshViewGameThread)
+
 	check(IsInGameThread())
 
 	const auto& View{Character->GetViewState()};
@@ -246,11 +340,13 @@ void UAlsAnimationInstance::RefreshViewGameThread()
 
 bool UAlsAnimationInstance::IsSpineRotationAllowed()
 {
-	return RotationMode == AlsRotationModeTags::Aiming;
+	return CompiledState.GetRotationMode() == EAlsCompiledRotationMode::Aiming;
 }
 
 void UAlsAnimationInstance::RefreshView(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshView)
+
 	if (!LocomotionAction.IsValid())
 	{
 		ViewState.YawAngle = FRotator3f::NormalizeAxis(UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw - LocomotionState.Rotation.Yaw));
@@ -259,8 +355,8 @@ void UAlsAnimationInstance::RefreshView(const float DeltaTime)
 		ViewState.PitchAmount = 0.5f - ViewState.PitchAngle / 180.0f;
 	}
 
-	const auto ViewAmount{1.0f - GetCurveValueClamped01(UAlsConstants::ViewBlockCurve())};
-	const auto AimingAmount{GetCurveValueClamped01(UAlsConstants::AllowAimingCurve())};
+	const auto ViewAmount{1.0f - GetCachedCurveValueClamped01(EAlsAnimationCurve::ViewBlock)};
+	const auto AimingAmount{GetCachedCurveValueClamped01(EAlsAnimationCurve::AllowAiming)};
 
 	ViewState.LookAmount = ViewAmount * (1.0f - AimingAmount);
 
@@ -271,6 +367,8 @@ void UAlsAnimationInstance::RefreshView(const float DeltaTime)
 
 void UAlsAnimationInstance::RefreshSpineRotation(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshSpineRotation)
+
 	auto& SpineRotation{ViewState.SpineRotation};
 
 	if (SpineRotation.bSpineRotationAllowed != IsSpineRotationAllowed())
@@ -311,13 +409,15 @@ void UAlsAnimationInstance::ReinitializeLookTowardsInput()
 
 void UAlsAnimationInstance::RefreshLookTowardsInput(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshLookTowardsInput)
+
 	auto& LookTowardsInput{ViewState.LookTowardsInput};
 
 	LookTowardsInput.bReinitializationRequired |= bPendingUpdate;
 
 	const auto CharacterYawAngle{UE_REAL_TO_FLOAT(LocomotionState.Rotation.Yaw)};
 
-	if (RotationMode != AlsRotationModeTags::VelocityDirection)
+	if (CompiledState.GetRotationMode() != EAlsCompiledRotationMode::VelocityDirection)
 	{
 		LookTowardsInput.WorldYawAngle = FRotator3f::NormalizeAxis(CharacterYawAngle + LookTowardsInput.YawAngle);
 		LookTowardsInput.bReinitializationRequired = false;
@@ -327,7 +427,7 @@ void UAlsAnimationInstance::RefreshLookTowardsInput(const float DeltaTime)
 	// Block look towards the input direction when the character is in the air to prevent head rotation "snap" when changing look sides.
 
 	const auto TargetYawAngle{
-		FRotator3f::NormalizeAxis((LocomotionState.bHasInput && LocomotionMode != AlsLocomotionModeTags::InAir
+		FRotator3f::NormalizeAxis((LocomotionState.bHasInput && CompiledState.GetLocomotionMode() != EAlsCompiledLocomotionMode::InAir
 			                           ? LocomotionState.InputYawAngle
 			                           : LocomotionState.TargetYawAngle) - CharacterYawAngle)
 	};
@@ -372,13 +472,15 @@ void UAlsAnimationInstance::ReinitializeLookTowardsCamera()
 
 void UAlsAnimationInstance::RefreshLookTowardsCamera(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshLookTowardsCamera)
+
 	auto& LookTowardsCamera{ViewState.LookTowardsCamera};
 
 	LookTowardsCamera.bReinitializationRequired |= bPendingUpdate;
 
 	const auto CharacterYawAngle{UE_REAL_TO_FLOAT(LocomotionState.Rotation.Yaw)};
 
-	if (RotationMode == AlsRotationModeTags::VelocityDirection && LocomotionState.bMoving)
+	if (CompiledState.GetRotationMode() == EAlsCompiledRotationMode::VelocityDirection && LocomotionState.bMoving)
 	{
 		LookTowardsCamera.WorldYawAngle = FRotator3f::NormalizeAxis(CharacterYawAngle + LookTowardsCamera.YawAngle);
 		LookTowardsCamera.bReinitializationRequired = false;
@@ -430,6 +532,8 @@ void UAlsAnimationInstance::RefreshLookTowardsCamera(const float DeltaTime)
 
 void UAlsAnimationInstance::RefreshLocomotionGameThread()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshLocomotionGameThread)
+
 	check(IsInGameThread())
 
 	const auto& Locomotion{Character->GetLocomotionState()};
@@ -489,6 +593,8 @@ void UAlsAnimationInstance::RefreshLocomotionGameThread()
 
 void UAlsAnimationInstance::RefreshGroundedGameThread()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshGroundedGameThread)
+
 	check(IsInGameThread())
 
 	GroundedState.bPivotActive = GroundedState.bPivotActivationRequested && !bPendingUpdate &&
@@ -499,12 +605,14 @@ void UAlsAnimationInstance::RefreshGroundedGameThread()
 
 void UAlsAnimationInstance::RefreshGrounded(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshGrounded)
+
 	// Always sample sprint block curve, otherwise issues with inertial blending may occur.
 
-	GroundedState.SprintBlockAmount = GetCurveValueClamped01(UAlsConstants::SprintBlockCurve());
-	GroundedState.HipsDirectionLockAmount = FMath::Clamp(GetCurveValue(UAlsConstants::HipsDirectionLockCurve()), -1.0f, 1.0f);
+	GroundedState.SprintBlockAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::SprintBlock);
+	GroundedState.HipsDirectionLockAmount = FMath::Clamp(GetCachedCurveValue(EAlsAnimationCurve::HipsDirectionLock), -1.0f, 1.0f);
 
-	if (LocomotionMode != AlsLocomotionModeTags::Grounded)
+	if (CompiledState.GetLocomotionMode() != EAlsCompiledLocomotionMode::Grounded)
 	{
 		GroundedState.VelocityBlend.bReinitializationRequired = true;
 		GroundedState.SprintTime = 0.0f;
@@ -553,10 +661,13 @@ void UAlsAnimationInstance::RefreshGrounded(const float DeltaTime)
 
 void UAlsAnimationInstance::RefreshMovementDirection()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshMovementDirection)
+
 	// Calculate the movement direction. This value represents the direction the character is moving relative to the camera during
 	// the looking direction / aiming modes and is used in the cycle blending to blend to the appropriate directional states.
 
-	if (RotationMode == AlsRotationModeTags::VelocityDirection || Gait == AlsGaitTags::Sprinting)
+	if (CompiledState.GetRotationMode() == EAlsCompiledRotationMode::VelocityDirection ||
+	    CompiledState.GetGait() == EAlsCompiledGait::Sprinting)
 	{
 		GroundedState.MovementDirection = EAlsMovementDirection::Forward;
 		return;
@@ -571,6 +682,8 @@ void UAlsAnimationInstance::RefreshMovementDirection()
 
 void UAlsAnimationInstance::RefreshVelocityBlend(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshVelocityBlend)
+
 	GroundedState.VelocityBlend.bReinitializationRequired |= bPendingUpdate;
 
 	// Calculate and interpolate the velocity blend amounts. This value represents the velocity amount of
@@ -617,21 +730,34 @@ void UAlsAnimationInstance::RefreshVelocityBlend(const float DeltaTime)
 
 void UAlsAnimationInstance::RefreshRotationYawOffsets()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshRotationYawOffsets)
+
 	// Set the rotation yaw offsets. These values influence the rotation yaw offset curve in the
 	// animation graph and are used to offset the character's rotation for more natural movement.
 	// The curves allow for fine control over how the offset behaves for each movement direction.
 
 	const auto RotationYawOffset{FRotator3f::NormalizeAxis(LocomotionState.VelocityYawAngle - UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw))};
 
-	GroundedState.RotationYawOffsets.ForwardAngle = Settings->Grounded.RotationYawOffsetForwardCurve->GetFloatValue(RotationYawOffset);
-	GroundedState.RotationYawOffsets.BackwardAngle = Settings->Grounded.RotationYawOffsetBackwardCurve->GetFloatValue(RotationYawOffset);
-	GroundedState.RotationYawOffsets.LeftAngle = Settings->Grounded.RotationYawOffsetLeftCurve->GetFloatValue(RotationYawOffset);
-	GroundedState.RotationYawOffsets.RightAngle = Settings->Grounded.RotationYawOffsetRightCurve->GetFloatValue(RotationYawOffset);
+	const auto& GroundedSettings{Settings->Grounded};
+
+	GroundedState.RotationYawOffsets.ForwardAngle = GroundedSettings.BakedRotationYawOffsetForwardCurve.Evaluate(
+		GroundedSettings.RotationYawOffsetForwardCurve, RotationYawOffset);
+
+	GroundedState.RotationYawOffsets.BackwardAngle = GroundedSettings.BakedRotationYawOffsetBackwardCurve.Evaluate(
+		GroundedSettings.RotationYawOffsetBackwardCurve, RotationYawOffset);
+
+	GroundedState.RotationYawOffsets.LeftAngle = GroundedSettings.BakedRotationYawOffsetLeftCurve.Evaluate(
+		GroundedSettings.RotationYawOffsetLeftCurve, RotationYawOffset);
+
+	GroundedState.RotationYawOffsets.RightAngle = GroundedSettings.BakedRotationYawOffsetRightCurve.Evaluate(
+		GroundedSettings.RotationYawOffsetRightCurve, RotationYawOffset);
 }
 
 void UAlsAnimationInstance::RefreshSprint(const FVector3f& RelativeAccelerationAmount, const float DeltaTime)
 {
-	if (Gait != AlsGaitTags::Sprinting)
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshSprint)
+
+	if (CompiledState.GetGait() != EAlsCompiledGait::Sprinting)
 	{
 		GroundedState.SprintTime = 0.0f;
 		GroundedState.SprintAccelerationAmount = 0.0f;
@@ -655,6 +781,8 @@ void UAlsAnimationInstance::RefreshSprint(const FVector3f& RelativeAccelerationA
 
 void UAlsAnimationInstance::RefreshStrideBlendAmount()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshStrideBlendAmount)
+
 	// Calculate the stride blend amount. This value is used within the blend spaces to scale the stride (distance feet travel)
 	// so that the character can walk or run at different movement speeds. It also allows the walk or run gait animations to
 	// blend independently while still matching the animation speed to the movement speed, preventing the character from needing
@@ -662,28 +790,34 @@ void UAlsAnimationInstance::RefreshStrideBlendAmount()
 
 	const auto Speed{LocomotionState.Speed / LocomotionState.Scale};
 
+	const auto& GroundedSettings{Settings->Grounded};
+
+	const auto WalkStrideBlend{
+		GroundedSettings.BakedStrideBlendAmountWalkCurve.Evaluate(GroundedSettings.StrideBlendAmountWalkCurve, Speed)
+	};
+
 	const auto StandingStrideBlend{
-		FMath::Lerp(Settings->Grounded.StrideBlendAmountWalkCurve->GetFloatValue(Speed),
-		            Settings->Grounded.StrideBlendAmountRunCurve->GetFloatValue(Speed),
+		FMath::Lerp(WalkStrideBlend,
+		            GroundedSettings.BakedStrideBlendAmountRunCurve.Evaluate(GroundedSettings.StrideBlendAmountRunCurve, Speed),
 		            PoseState.UnweightedGaitRunningAmount)
 	};
 
 	// Crouching stride blend amount.
 
-	GroundedState.StrideBlendAmount = FMath::Lerp(StandingStrideBlend,
-	                                              Settings->Grounded.StrideBlendAmountWalkCurve->GetFloatValue(Speed),
-	                                              PoseState.CrouchingAmount);
+	GroundedState.StrideBlendAmount = FMath::Lerp(StandingStrideBlend, WalkStrideBlend, PoseState.CrouchingAmount);
 }
 
 void UAlsAnimationInstance::RefreshWalkRunBlendAmount()
 {
 	// Calculate the walk run blend amount. This value is used within the blend spaces to blend between walking and running.
 
-	GroundedState.WalkRunBlendAmount = Gait == AlsGaitTags::Walking ? 0.0f : 1.0f;
+	GroundedState.WalkRunBlendAmount = CompiledState.GetGait() == EAlsCompiledGait::Walking ? 0.0f : 1.0f;
 }
 
 void UAlsAnimationInstance::RefreshStandingPlayRate()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshStandingPlayRate)
+
 	// Calculate the standing play rate by dividing the character's speed by the animated speed for each gait.
 	// The interpolation is determined by the gait amount curve that exists on every locomotion cycle so that
 	// the play rate is always in sync with the currently blended animation. The value is also divided by the
@@ -707,6 +841,8 @@ void UAlsAnimationInstance::RefreshStandingPlayRate()
 
 void UAlsAnimationInstance::RefreshCrouchingPlayRate()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshCrouchingPlayRate)
+
 	// Calculate the crouching play rate by dividing the character's speed by the animated speed. This value needs
 	// to be separate from the standing play rate to improve the blend from crouching to standing while in motion.
 
@@ -717,6 +853,8 @@ void UAlsAnimationInstance::RefreshCrouchingPlayRate()
 
 void UAlsAnimationInstance::RefreshGroundedLeanAmount(const FVector3f& RelativeAccelerationAmount, const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshGroundedLeanAmount)
+
 	if (bPendingUpdate)
 	{
 		LeanState.RightAmount = RelativeAccelerationAmount.Y;
@@ -748,6 +886,8 @@ void UAlsAnimationInstance::ResetGroundedLeanAmount(const float DeltaTime)
 
 void UAlsAnimationInstance::RefreshInAirGameThread()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshInAirGameThread)
+
 	check(IsInGameThread())
 
 	InAirState.bJumped = !bPendingUpdate && (InAirState.bJumped || InAirState.bJumpRequested);
@@ -756,6 +896,8 @@ void UAlsAnimationInstance::RefreshInAirGameThread()
 
 void UAlsAnimationInstance::RefreshInAir(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshInAir)
+
 	if (InAirState.bJumped)
 	{
 		static constexpr auto ReferenceSpeed{600.0f};
@@ -765,7 +907,7 @@ void UAlsAnimationInstance::RefreshInAir(const float DeltaTime)
 		InAirState.JumpPlayRate = UAlsMath::LerpClamped(MinPlayRate, MaxPlayRate, LocomotionState.Speed / ReferenceSpeed);
 	}
 
-	if (LocomotionMode != AlsLocomotionModeTags::InAir)
+	if (CompiledState.GetLocomotionMode() != EAlsCompiledLocomotionMode::InAir)
 	{
 		return;
 	}
@@ -781,6 +923,8 @@ void UAlsAnimationInstance::RefreshInAir(const float DeltaTime)
 
 void UAlsAnimationInstance::RefreshGroundPredictionAmount()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshGroundPredictionAmount)
+
 	// Calculate the ground prediction weight by tracing in the velocity direction to find a walkable surface the character
 	// is falling toward and getting the "time" (range from 0 to 1, 1 being maximum, 0 being about to ground) till impact.
 	// The ground prediction amount curve is used to control how the time affects the final amount for a smooth blend.
@@ -793,7 +937,7 @@ void UAlsAnimationInstance::RefreshGroundPredictionAmount()
 		return;
 	}
 
-	const auto AllowanceAmount{1.0f - GetCurveValueClamped01(UAlsConstants::GroundPredictionBlockCurve())};
+	const auto AllowanceAmount{1.0f - GetCachedCurveValueClamped01(EAlsAnimationCurve::GroundPredictionBlock)};
 	if (AllowanceAmount <= KINDA_SMALL_NUMBER)
 	{
 		InAirState.GroundPredictionAmount = 0.0f;
@@ -818,6 +962,14 @@ void UAlsAnimationInstance::RefreshGroundPredictionAmount()
 		                                                      InAirState.VerticalVelocity) * LocomotionState.Scale
 	};
 
+	// If the sweep is deferred, keep the ground prediction amount from the last sweep.
+
+	if (!UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(GetWorld(), EAlsPhysicsQueryCategory::GroundPrediction,
+	                                                       AlsAnimationInstance::GetSignificance(Character), !bPendingUpdate))
+	{
+		return;
+	}
+
 	FCollisionObjectQueryParams ObjectQueryParameters;
 	for (const auto ObjectType : Settings->InAir.GroundPredictionSweepObjectTypes)
 	{
@@ -854,12 +1006,15 @@ void UAlsAnimationInstance::RefreshGroundPredictionAmount()
 #endif
 
 	InAirState.GroundPredictionAmount = bGroundValid
-		                                    ? Settings->InAir.GroundPredictionAmountCurve->GetFloatValue(Hit.Time) * AllowanceAmount
+		                                    ? Settings->InAir.BakedGroundPredictionAmountCurve.Evaluate(
+			                                      Settings->InAir.GroundPredictionAmountCurve, Hit.Time) * AllowanceAmount
 		                                    : 0.0f;
 }
 
 void UAlsAnimationInstance::RefreshInAirLeanAmount(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshInAirLeanAmount)
+
 	// Use the relative velocity direction and amount to determine how much the character should lean
 	// while in air. The lean amount curve gets the vertical velocity and is used as a multiplier to
 	// smoothly reverse the leaning direction when transitioning from moving upwards to moving downwards.
@@ -868,7 +1023,7 @@ void UAlsAnimationInstance::RefreshInAirLeanAmount(const float DeltaTime)
 
 	const auto RelativeVelocity{
 		FVector3f{LocomotionState.RotationQuaternion.UnrotateVector(LocomotionState.Velocity)} /
-		ReferenceSpeed * Settings->InAir.LeanAmountCurve->GetFloatValue(InAirState.VerticalVelocity)
+		ReferenceSpeed * Settings->InAir.BakedLeanAmountCurve.Evaluate(Settings->InAir.LeanAmountCurve, InAirState.VerticalVelocity)
 	};
 
 	if (bPendingUpdate)
@@ -888,43 +1043,87 @@ void UAlsAnimationInstance::RefreshInAirLeanAmount(const float DeltaTime)
 
 void UAlsAnimationInstance::RefreshFeetGameThread()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshFeetGameThread)
+
+	check(IsInGameThread())
+
+	// Only the asynchronous traces need the game thread here. The foot targets are read later in RefreshFeetTargets().
+
+	RefreshFootIkTraceGameThread(FeetState.Left);
+	RefreshFootIkTraceGameThread(FeetState.Right);
+}
+
+void UAlsAnimationInstance::RefreshFootIkTraceGameThread(FAlsFootState& FootState)
+{
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshFootIkTraceGameThread)
+
 	check(IsInGameThread())
 
-	const auto* Mesh{GetSkelMeshComponent()};
+	auto& IkTrace{FootState.IkTrace};
+	auto* World{GetWorld()};
 
-	const auto FootLeftTargetTransform{
-		Mesh->GetSocketTransform(Settings->General.bUseFootIkBones
-			                         ? UAlsConstants::FootLeftIkBone()
-			                         : UAlsConstants::FootLeftVirtualBone())
-	};
+	const auto WorldTime{World->GetTimeSeconds()};
 
-	FeetState.Left.TargetLocation = FootLeftTargetTransform.GetLocation();
-	FeetState.Left.TargetRotation = FootLeftTargetTransform.GetRotation();
+	// Fetch the result of the asynchronous trace requested in the previous frame. The
+	// result is not available if the animation instance was not updated in the last frame.
 
-	const auto FootRightTargetTransform{
-		Mesh->GetSocketTransform(Settings->General.bUseFootIkBones
-			                         ? UAlsConstants::FootRightIkBone()
-			                         : UAlsConstants::FootRightVirtualBone())
-	};
+	FTraceDatum TraceDatum;
+	if (IkTrace.PendingHandle.IsValid() && World->QueryTraceData(IkTrace.PendingHandle, TraceDatum))
+	{
+		IkTrace.Hit = TraceDatum.OutHits.Num() > 0 ? TraceDatum.OutHits[0] : FHitResult{TraceDatum.Start, TraceDatum.End};
+		IkTrace.Location = IkTrace.PendingLocation;
+		IkTrace.Time = IkTrace.PendingTime;
+	}
+
+	IkTrace.PendingHandle = {};
 
-	FeetState.Right.TargetLocation = FootRightTargetTransform.GetLocation();
-	FeetState.Right.TargetRotation = FootRightTargetTransform.GetRotation();
+	IkTrace.bHitValid = Settings->Feet.bUseAsyncIkTraces && IkTrace.Time > 0.0f &&
+	                    WorldTime - IkTrace.Time <= Settings->Feet.AsyncIkTraceMaxAge;
+
+	if (!Settings->Feet.bUseAsyncIkTraces || CompiledState.GetLocomotionMode() == EAlsCompiledLocomotionMode::InAir ||
+	    !FAnimWeight::IsRelevant(FootState.IkAmount) ||
+	    !UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(World, EAlsPhysicsQueryCategory::FootIk,
+	                                                       AlsAnimationInstance::GetSignificance(Character)))
+	{
+		return;
+	}
+
+	// The final foot location is not known yet, so approximate it using the foot target and lock state from the previous frame.
+
+	const auto FootLocation{FMath::Lerp(FootState.TargetLocation, FootState.LockLocation, FootState.LockAmount)};
+
+	IkTrace.PendingLocation = {FootLocation.X, FootLocation.Y, GetSkelMeshComponent()->GetComponentLocation().Z};
+	IkTrace.PendingTime = WorldTime;
+
+	IkTrace.PendingHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single,
+	                                                       IkTrace.PendingLocation + FVector{
+		                                                       0.0f, 0.0f, Settings->Feet.IkTraceDistanceUpward * LocomotionState.Scale
+	                                                       },
+	                                                       IkTrace.PendingLocation - FVector{
+		                                                       0.0f, 0.0f, Settings->Feet.IkTraceDistanceDownward * LocomotionState.Scale
+	                                                       },
+	                                                       UEngineTypes::ConvertToCollisionChannel(Settings->Feet.IkTraceChannel),
+	                                                       {ANSI_TO_TCHAR(__FUNCTION__), true, Character});
 }
 
 void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 {
-	FeetState.FootPlantedAmount = FMath::Clamp(GetCurveValue(UAlsConstants::FootPlantedCurve()), -1.0f, 1.0f);
-	FeetState.FeetCrossingAmount = GetCurveValueClamped01(UAlsConstants::FeetCrossingCurve());
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshFeet)
+
+	RefreshFeetTargets();
+
+	FeetState.FootPlantedAmount = FMath::Clamp(GetCachedCurveValue(EAlsAnimationCurve::FootPlanted), -1.0f, 1.0f);
+	FeetState.FeetCrossingAmount = GetCachedCurveValueClamped01(EAlsAnimationCurve::FeetCrossing);
 
 	FeetState.MinMaxPelvisOffsetZ = FVector2D::ZeroVector;
 
 	const auto ComponentTransformInverse{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform().Inverse()};
 
-	RefreshFoot(FeetState.Left, UAlsConstants::FootLeftIkCurve(),
-	            UAlsConstants::FootLeftLockCurve(), ComponentTransformInverse, DeltaTime);
+	RefreshFoot(FeetState.Left, EAlsAnimationCurve::FootLeftIk,
+	            EAlsAnimationCurve::FootLeftLock, ComponentTransformInverse, DeltaTime);
 
-	RefreshFoot(FeetState.Right, UAlsConstants::FootRightIkCurve(),
-	            UAlsConstants::FootRightLockCurve(), ComponentTransformInverse, DeltaTime);
+	RefreshFoot(FeetState.Right, EAlsAnimationCurve::FootRightIk,
+	            EAlsAnimationCurve::FootRightLock, ComponentTransformInverse, DeltaTime);
 
 	FeetState.MinMaxPelvisOffsetZ.X = FMath::Min(FeetState.Left.OffsetTargetLocation.Z, FeetState.Right.OffsetTargetLocation.Z) /
 	                                  LocomotionState.Scale;
@@ -933,10 +1132,25 @@ void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 	                                  LocomotionState.Scale;
 }
 
-void UAlsAnimationInstance::RefreshFoot(FAlsFootState& FootState, const FName& FootIkCurveName, const FName& FootLockCurveName,
-                                        const FTransform& ComponentTransformInverse, const float DeltaTime) const
+void UAlsAnimationInstance::RefreshFeetTargets()
 {
-	FootState.IkAmount = GetCurveValueClamped01(FootIkCurveName);
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshFeetTargets)
+
+	// Read the foot target transforms from the pose evaluated by the animation instance proxy in the previous
+	// frame, so that neither the skeletal mesh component nor its bone name lookups are needed on each update.
+
+	const auto& Proxy{GetProxyOnAnyThread<FAlsAnimationInstanceProxy>()};
+
+	AlsAnimationInstance::RefreshFootTarget(FeetState.Left, Proxy.GetFootTargetTransform(0), Proxy.GetComponentTransform());
+	AlsAnimationInstance::RefreshFootTarget(FeetState.Right, Proxy.GetFootTargetTransform(1), Proxy.GetComponentTransform());
+}
+
+void UAlsAnimationInstance::RefreshFoot(FAlsFootState& FootState, const EAlsAnimationCurve FootIkCurve,
+                                        const EAlsAnimationCurve FootLockCurve, const FTransform& ComponentTransformInverse, const float DeltaTime) const
+{
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshFoot)
+
+	FootState.IkAmount = GetCachedCurveValueClamped01(FootIkCurve);
 
 	ProcessFootLockTeleport(FootState);
 
@@ -945,7 +1159,7 @@ void UAlsAnimationInstance::RefreshFoot(FAlsFootState& FootState, const FName& F
 	auto FinalLocation{FootState.TargetLocation};
 	auto FinalRotation{FootState.TargetRotation};
 
-	RefreshFootLock(FootState, FootLockCurveName, ComponentTransformInverse, DeltaTime, FinalLocation, FinalRotation);
+	RefreshFootLock(FootState, FootLockCurve, ComponentTransformInverse, DeltaTime, FinalLocation, FinalRotation);
 
 	RefreshFootOffset(FootState, DeltaTime, FinalLocation, FinalRotation);
 
@@ -1010,15 +1224,17 @@ void UAlsAnimationInstance::ProcessFootLockBaseChange(FAlsFootState& FootState,
 	}
 }
 
-void UAlsAnimationInstance::RefreshFootLock(FAlsFootState& FootState, const FName& FootLockCurveName,
+void UAlsAnimationInstance::RefreshFootLock(FAlsFootState& FootState, const EAlsAnimationCurve FootLockCurve,
                                             const FTransform& ComponentTransformInverse, const float DeltaTime,
                                             FVector& FinalLocation, FQuat& FinalRotation) const
 {
-	auto NewFootLockAmount{GetCurveValueClamped01(FootLockCurveName)};
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshFootLock)
+
+	auto NewFootLockAmount{GetCachedCurveValueClamped01(FootLockCurve)};
 
 	NewFootLockAmount *= 1.0f - RotateInPlaceState.FootLockBlockAmount;
 
-	if (LocomotionState.bMovingSmooth || LocomotionMode != AlsLocomotionModeTags::Grounded)
+	if (LocomotionState.bMovingSmooth || CompiledState.GetLocomotionMode() != EAlsCompiledLocomotionMode::Grounded)
 	{
 		// Smoothly disable foot locking if the character is moving or in the air,
 		// instead of relying on the curve value from the animation blueprint.
@@ -1116,6 +1332,8 @@ void UAlsAnimationInstance::RefreshFootLock(FAlsFootState& FootState, const FNam
 void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const float DeltaTime,
                                               FVector& FinalLocation, FQuat& FinalRotation) const
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshFootOffset)
+
 	if (!FAnimWeight::IsRelevant(FootState.IkAmount))
 	{
 		FootState.OffsetTargetLocation = FVector::ZeroVector;
@@ -1124,7 +1342,7 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 		return;
 	}
 
-	if (LocomotionMode == AlsLocomotionModeTags::InAir)
+	if (CompiledState.GetLocomotionMode() == EAlsCompiledLocomotionMode::InAir)
 	{
 		FootState.OffsetTargetLocation = FVector::ZeroVector;
 		FootState.OffsetTargetRotation = FQuat::Identity;
@@ -1151,20 +1369,51 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 
 	// Trace downward from the foot location to find the geometry. If the surface is walkable, save the impact location and normal.
 
-	const FVector TraceLocation{
-		FinalLocation.X, FinalLocation.Y, GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform().GetLocation().Z
-	};
-
+	FVector TraceLocation;
 	FHitResult Hit;
-	GetWorld()->LineTraceSingleByChannel(Hit,
-	                                     TraceLocation + FVector{
-		                                     0.0f, 0.0f, Settings->Feet.IkTraceDistanceUpward * LocomotionState.Scale
-	                                     },
-	                                     TraceLocation - FVector{
-		                                     0.0f, 0.0f, Settings->Feet.IkTraceDistanceDownward * LocomotionState.Scale
-	                                     },
-	                                     UEngineTypes::ConvertToCollisionChannel(Settings->Feet.IkTraceChannel),
-	                                     {ANSI_TO_TCHAR(__FUNCTION__), true, Character});
+
+	if (FootState.IkTrace.bHitValid && !bPendingUpdate && !bTeleported)
+	{
+		// Use the result of the asynchronous trace requested in the previous frame.
+
+		TraceLocation = FootState.IkTrace.Location;
+		Hit = FootState.IkTrace.Hit;
+
+		INC_DWORD_STAT(STAT_AlsFootIkAsyncTraces)
+		ALS_TRACE_COUNTER_ADD(FootIkAsyncTraces, 1);
+	}
+	else if (FootState.IkTrace.Time > 0.0f && !bPendingUpdate && !bTeleported &&
+	         !UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(GetWorld(), EAlsPhysicsQueryCategory::FootIk,
+	                                                            AlsAnimationInstance::GetSignificance(Character)))
+	{
+		// The trace was deferred, so reuse the result of the last trace, even if it's too old for the asynchronous traces.
+
+		TraceLocation = FootState.IkTrace.Location;
+		Hit = FootState.IkTrace.Hit;
+	}
+	else
+	{
+		TraceLocation = {
+			FinalLocation.X, FinalLocation.Y, GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform().GetLocation().Z
+		};
+
+		GetWorld()->LineTraceSingleByChannel(Hit,
+		                                     TraceLocation + FVector{
+			                                     0.0f, 0.0f, Settings->Feet.IkTraceDistanceUpward * LocomotionState.Scale
+		                                     },
+		                                     TraceLocation - FVector{
+			                                     0.0f, 0.0f, Settings->Feet.IkTraceDistanceDownward * LocomotionState.Scale
+		                                     },
+		                                     UEngineTypes::ConvertToCollisionChannel(Settings->Feet.IkTraceChannel),
+		                                     {ANSI_TO_TCHAR(__FUNCTION__), true, Character});
+
+		INC_DWORD_STAT(STAT_AlsFootIkSyncTraces)
+		ALS_TRACE_COUNTER_ADD(FootIkSyncTraces, 1);
+
+		FootState.IkTrace.Hit = Hit;
+		FootState.IkTrace.Location = TraceLocation;
+		FootState.IkTrace.Time = GetWorld()->GetTimeSeconds();
+	}
 
 	const auto bGroundValid{Hit.IsValidBlockingHit() && Hit.ImpactNormal.Z >= LocomotionState.WalkableFloorZ};
 
@@ -1201,9 +1450,9 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 		// Calculate the rotation offset.
 
 		FootState.OffsetTargetRotation = FRotator{
-			-UAlsMath::DirectionToAngle({Hit.ImpactNormal.Z, Hit.ImpactNormal.X}),
+			-UAlsMath::DirectionToAngle<FAlsFastTrigonometry>({Hit.ImpactNormal.Z, Hit.ImpactNormal.X}),
 			0.0f,
-			UAlsMath::DirectionToAngle({Hit.ImpactNormal.Z, Hit.ImpactNormal.Y})
+			UAlsMath::DirectionToAngle<FAlsFastTrigonometry>({Hit.ImpactNormal.Z, Hit.ImpactNormal.Y})
 		}.Quaternion();
 	}
 
@@ -1238,7 +1487,7 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 
 void UAlsAnimationInstance::PlayQuickStopAnimation()
 {
-	if (RotationMode != AlsRotationModeTags::VelocityDirection)
+	if (CompiledState.GetRotationMode() != EAlsCompiledRotationMode::VelocityDirection)
 	{
 		PlayTransitionLeftAnimation(Settings->Transitions.QuickStopBlendInTime, Settings->Transitions.QuickStopBlendOutTime,
 		                            Settings->Transitions.QuickStopPlayRate.X, Settings->Transitions.QuickStopStartTime);
@@ -1298,7 +1547,7 @@ void UAlsAnimationInstance::PlayTransitionLeftAnimation(const float BlendInTime,
 		return;
 	}
 
-	PlayTransitionAnimation(Stance == AlsStanceTags::Crouching
+	PlayTransitionAnimation(CompiledState.GetStance() == EAlsCompiledStance::Crouching
 		                        ? Settings->Transitions.CrouchingTransitionLeftAnimation
 		                        : Settings->Transitions.StandingTransitionLeftAnimation,
 	                        BlendInTime, BlendOutTime, PlayRate, StartTime, bFromStandingIdleOnly);
@@ -1312,7 +1561,7 @@ void UAlsAnimationInstance::PlayTransitionRightAnimation(const float BlendInTime
 		return;
 	}
 
-	PlayTransitionAnimation(Stance == AlsStanceTags::Crouching
+	PlayTransitionAnimation(CompiledState.GetStance() == EAlsCompiledStance::Crouching
 		                        ? Settings->Transitions.CrouchingTransitionRightAnimation
 		                        : Settings->Transitions.StandingTransitionRightAnimation,
 	                        BlendInTime, BlendOutTime, PlayRate, StartTime, bFromStandingIdleOnly);
@@ -1329,22 +1578,27 @@ void UAlsAnimationInstance::StopTransitionAndTurnInPlaceAnimations(const float B
 
 void UAlsAnimationInstance::RefreshTransitions()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshTransitions)
+
 	// The allow transitions curve is modified within certain states, so that transitions allowed will be true while in those states.
 
-	TransitionsState.bTransitionsAllowed = FAnimWeight::IsFullWeight(GetCurveValue(UAlsConstants::AllowTransitionsCurve()));
+	TransitionsState.bTransitionsAllowed = FAnimWeight::IsFullWeight(GetCachedCurveValue(EAlsAnimationCurve::AllowTransitions));
 
 	RefreshDynamicTransition();
 }
 
 void UAlsAnimationInstance::RefreshDynamicTransition()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshDynamicTransition)
+
 	if (TransitionsState.DynamicTransitionsFrameDelay > 0)
 	{
 		TransitionsState.DynamicTransitionsFrameDelay -= 1;
 		return;
 	}
 
-	if (!TransitionsState.bTransitionsAllowed || LocomotionState.bMoving || LocomotionMode != AlsLocomotionModeTags::Grounded)
+	if (!TransitionsState.bTransitionsAllowed || LocomotionState.bMoving ||
+	    CompiledState.GetLocomotionMode() != EAlsCompiledLocomotionMode::Grounded)
 	{
 		return;
 	}
@@ -1379,25 +1633,25 @@ void UAlsAnimationInstance::RefreshDynamicTransition()
 
 	if (!bTransitionLeftAllowed)
 	{
-		DynamicTransitionAnimation = Stance == AlsStanceTags::Crouching
+		DynamicTransitionAnimation = CompiledState.GetStance() == EAlsCompiledStance::Crouching
 			                             ? Settings->Transitions.CrouchingDynamicTransitionRightAnimation
 			                             : Settings->Transitions.StandingDynamicTransitionRightAnimation;
 	}
 	else if (!bTransitionRightAllowed)
 	{
-		DynamicTransitionAnimation = Stance == AlsStanceTags::Crouching
+		DynamicTransitionAnimation = CompiledState.GetStance() == EAlsCompiledStance::Crouching
 			                             ? Settings->Transitions.CrouchingDynamicTransitionLeftAnimation
 			                             : Settings->Transitions.StandingDynamicTransitionLeftAnimation;
 	}
 	else if (FootLockLeftDistanceSquared >= FootLockRightDistanceSquared)
 	{
-		DynamicTransitionAnimation = Stance == AlsStanceTags::Crouching
+		DynamicTransitionAnimation = CompiledState.GetStance() == EAlsCompiledStance::Crouching
 			                             ? Settings->Transitions.CrouchingDynamicTransitionLeftAnimation
 			                             : Settings->Transitions.StandingDynamicTransitionLeftAnimation;
 	}
 	else
 	{
-		DynamicTransitionAnimation = Stance == AlsStanceTags::Crouching
+		DynamicTransitionAnimation = CompiledState.GetStance() == EAlsCompiledStance::Crouching
 			                             ? Settings->Transitions.CrouchingDynamicTransitionRightAnimation
 			                             : Settings->Transitions.StandingDynamicTransitionRightAnimation;
 	}
@@ -1432,16 +1686,19 @@ void UAlsAnimationInstance::PlayQueuedDynamicTransitionAnimation()
 
 bool UAlsAnimationInstance::IsRotateInPlaceAllowed()
 {
-	return RotationMode == AlsRotationModeTags::Aiming || ViewMode == AlsViewModeTags::FirstPerson;
+	return CompiledState.GetRotationMode() == EAlsCompiledRotationMode::Aiming ||
+	       CompiledState.GetViewMode() == EAlsCompiledViewMode::FirstPerson;
 }
 
 void UAlsAnimationInstance::RefreshRotateInPlace(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshRotateInPlace)
+
 	static constexpr auto PlayRateInterpolationSpeed{5.0f};
 
 	// Rotate in place is allowed only if the character is standing still and aiming or in first-person view mode.
 
-	if (LocomotionState.bMoving || LocomotionMode != AlsLocomotionModeTags::Grounded || !IsRotateInPlaceAllowed())
+	if (LocomotionState.bMoving || CompiledState.GetLocomotionMode() != EAlsCompiledLocomotionMode::Grounded || !IsRotateInPlaceAllowed())
 	{
 		RotateInPlaceState.bRotatingLeft = false;
 		RotateInPlaceState.bRotatingRight = false;
@@ -1504,15 +1761,18 @@ void UAlsAnimationInstance::RefreshRotateInPlace(const float DeltaTime)
 
 bool UAlsAnimationInstance::IsTurnInPlaceAllowed()
 {
-	return RotationMode == AlsRotationModeTags::LookingDirection && ViewMode != AlsViewModeTags::FirstPerson;
+	return CompiledState.GetRotationMode() == EAlsCompiledRotationMode::LookingDirection &&
+	       CompiledState.GetViewMode() != EAlsCompiledViewMode::FirstPerson;
 }
 
 void UAlsAnimationInstance::RefreshTurnInPlace(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshTurnInPlace)
+
 	// Turn in place is allowed only if transitions are allowed, the character
 	// standing still and looking at the camera and not in first-person mode.
 
-	if (LocomotionState.bMoving || LocomotionMode != AlsLocomotionModeTags::Grounded || !IsTurnInPlaceAllowed())
+	if (LocomotionState.bMoving || CompiledState.GetLocomotionMode() != EAlsCompiledLocomotionMode::Grounded || !IsTurnInPlaceAllowed())
 	{
 		TurnInPlaceState.ActivationDelay = 0.0f;
 		TurnInPlaceState.bFootLockDisabled = false;
@@ -1559,7 +1819,7 @@ void UAlsAnimationInstance::RefreshTurnInPlace(const float DeltaTime)
 	UAlsTurnInPlaceSettings* TurnInPlaceSettings{nullptr};
 	FName TurnInPlaceSlotName;
 
-	if (Stance == AlsStanceTags::Standing)
+	if (CompiledState.GetStance() == EAlsCompiledStance::Standing)
 	{
 		TurnInPlaceSlotName = UAlsConstants::TurnInPlaceStandingSlot();
 
@@ -1578,7 +1838,7 @@ void UAlsAnimationInstance::RefreshTurnInPlace(const float DeltaTime)
 				                      : Settings->TurnInPlace.StandingTurn180Right;
 		}
 	}
-	else if (Stance == AlsStanceTags::Crouching)
+	else if (CompiledState.GetStance() == EAlsCompiledStance::Crouching)
 	{
 		TurnInPlaceSlotName = UAlsConstants::TurnInPlaceCrouchingSlot();
 
@@ -1644,9 +1904,11 @@ void UAlsAnimationInstance::PlayQueuedTurnInPlaceAnimation()
 
 void UAlsAnimationInstance::RefreshRagdollingGameThread()
 {
+	ALS_TRACE_SCOPE(UAlsAnimationInstance_RefreshRagdollingGameThread)
+
 	check(IsInGameThread())
 
-	if (LocomotionAction != AlsLocomotionActionTags::Ragdolling)
+	if (CompiledState.GetLocomotionAction() != EAlsCompiledLocomotionAction::Ragdolling)
 	{
 		return;
 	}
@@ -1679,3 +1941,13 @@ float UAlsAnimationInstance::GetCurveValueClamped01(const FName& CurveName) cons
 {
 	return UAlsMath::Clamp01(GetCurveValue(CurveName));
 }
+
+float UAlsAnimationInstance::GetCachedCurveValue(const EAlsAnimationCurve Curve) const
+{
+	return CurveCache.GetValue(static_cast<uint8>(Curve));
+}
+
+float UAlsAnimationInstance::GetCachedCurveValueClamped01(const EAlsAnimationCurve Curve) const
+{
+	return CurveCache.GetValueClamped01(static_cast<uint8>(Curve));
+}
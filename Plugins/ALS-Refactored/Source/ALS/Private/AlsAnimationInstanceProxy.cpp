@@ -0,0 +1,82 @@
+#include "AlsAnimationInstanceProxy.h"
+
+#include "AlsAnimationInstance.h"
+#include "Settings/AlsAnimationInstanceSettings.h"
+#include "Utility/AlsConstants.h"
+#include "Utility/AlsTrace.h"
+
+void FAlsAnimationInstanceProxy::PreUpdate(UAnimInstance* AnimationInstance, const float DeltaTime)
+{
+	Super::PreUpdate(AnimationInstance, DeltaTime);
+
+	const auto* AlsAnimationInstance{Cast<UAlsAnimationInstance>(AnimationInstance)};
+
+	bUseFootIkBones = IsValid(AlsAnimationInstance) && IsValid(AlsAnimationInstance->Settings) &&
+	                  AlsAnimationInstance->Settings->General.bUseFootIkBones;
+}
+
+bool FAlsAnimationInstanceProxy::Evaluate(FPoseContext& Output)
+{
+	EvaluateAnimationNode(Output);
+
+	RefreshFootTargetTransforms(Output.Pose);
+
+	return true;
+}
+
+void FAlsAnimationInstanceProxy::RefreshFootTargetTransforms(const FCompactPose& Pose)
+{
+	ALS_TRACE_SCOPE(FAlsAnimationInstanceProxy_RefreshFootTargetTransforms)
+
+	const auto& BoneContainer{Pose.GetBoneContainer()};
+	const auto* Skeleton{BoneContainer.GetSkeletonAsset()};
+
+	if (FootTargetBonesSkeleton.Get() != Skeleton || bFootTargetBonesUseIkBones != bUseFootIkBones)
+	{
+		FootTargetBonesSkeleton = Skeleton;
+		bFootTargetBonesUseIkBones = bUseFootIkBones;
+
+		const auto* ReferenceSkeleton{IsValid(Skeleton) ? &Skeleton->GetReferenceSkeleton() : nullptr};
+
+		FootTargetSkeletonBoneIndices[0] = ReferenceSkeleton == nullptr
+			                                   ? INDEX_NONE
+			                                   : ReferenceSkeleton->FindBoneIndex(bFootTargetBonesUseIkBones
+				                                                                      ? UAlsConstants::FootLeftIkBone()
+				                                                                      : UAlsConstants::FootLeftVirtualBone());
+
+		FootTargetSkeletonBoneIndices[1] = ReferenceSkeleton == nullptr
+			                                   ? INDEX_NONE
+			                                   : ReferenceSkeleton->FindBoneIndex(bFootTargetBonesUseIkBones
+				                                                                      ? UAlsConstants::FootRightIkBone()
+				                                                                      : UAlsConstants::FootRightVirtualBone());
+	}
+
+	for (auto FootIndex{0}; FootIndex < 2; FootIndex++)
+	{
+		// The compact pose bone indices depend on the current level of detail, so they are not cached.
+
+		const auto BoneIndex{
+			FootTargetSkeletonBoneIndices[FootIndex] == INDEX_NONE
+				? FCompactPoseBoneIndex{INDEX_NONE}
+				: BoneContainer.GetCompactPoseIndexFromSkeletonIndex(FootTargetSkeletonBoneIndices[FootIndex])
+		};
+
+		if (!BoneIndex.IsValid())
+		{
+			FootTargetTransforms[FootIndex] = FTransform::Identity;
+			continue;
+		}
+
+		// Only the chain of the foot target bone is converted to component space, not the whole pose.
+
+		auto Transform{Pose[BoneIndex]};
+
+		for (auto ParentIndex{Pose.GetParentBoneIndex(BoneIndex)}; ParentIndex.IsValid();
+		     ParentIndex = Pose.GetParentBoneIndex(ParentIndex))
+		{
+			Transform *= Pose[ParentIndex];
+		}
+
+		FootTargetTransforms[FootIndex] = Transform;
+	}
+}
@@ -2,6 +2,8 @@
 
 #include "AlsAnimationInstance.h"
 #include "AlsCharacterMovementComponent.h"
+#include "AlsLocomotionBatchSubsystem.h"
+#include "AlsSignificanceSubsystem.h"
 #include "TimerManager.h"
 #include "Components/CapsuleComponent.h"
 #include "Curves/CurveFloat.h"
@@ -13,6 +15,7 @@
 #include "Utility/AlsLog.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsMath.h"
+#include "Utility/AlsTrace.h"
 #include "Utility/AlsUtility.h"
 
 namespace AlsCharacterConstants
@@ -41,6 +44,10 @@ AAlsCharacter::AAlsCharacter(const FObjectInitializer& Initializer) : Super(
 
 	AlsCharacterMovement = Cast<UAlsCharacterMovementComponent>(GetCharacterMovement());
 
+	// Compile the default state here so that the default object used by the animation blueprint preview also has it.
+
+	RefreshCompiledState();
+
 	// This will prevent the editor from combining component details with actor details.
 	// Component details can still be accessed from the actor's component hierarchy.
 
@@ -69,16 +76,15 @@ void AAlsCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
 	Parameters.bIsPushBased = true;
 
 	Parameters.Condition = COND_SkipOwner;
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DesiredStance, Parameters)
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DesiredGait, Parameters)
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, bDesiredAiming, Parameters)
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DesiredRotationMode, Parameters)
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ViewMode, Parameters)
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, OverlayMode, Parameters)
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DesiredState, Parameters)
 
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, RawViewRotation, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, InputDirection, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, RagdollTargetLocation, Parameters)
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, RagdollSnapshot, Parameters)
+
+	Parameters.Condition = COND_None;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ActionEvents, Parameters)
 }
 
 void AAlsCharacter::PreRegisterAllComponents()
@@ -90,6 +96,9 @@ void AAlsCharacter::PreRegisterAllComponents()
 	Stance = DesiredStance;
 	Gait = DesiredGait;
 
+	RefreshCompiledState();
+	RefreshDesiredState();
+
 	SetRawViewRotation(Super::GetViewRotation().GetNormalized());
 
 	ViewState.NetworkSmoothing.InitialRotation = RawViewRotation;
@@ -97,6 +106,8 @@ void AAlsCharacter::PreRegisterAllComponents()
 	ViewState.Rotation = RawViewRotation;
 	ViewState.PreviousYawAngle = UE_REAL_TO_FLOAT(RawViewRotation.Yaw);
 
+	SignificanceState.ViewRotation = RawViewRotation;
+
 	const auto& ActorTransform{GetActorTransform()};
 
 	LocomotionState.Location = ActorTransform.GetLocation();
@@ -145,6 +156,10 @@ void AAlsCharacter::BeginPlay()
 	ALS_ENSURE_MESSAGE(!bUseControllerRotationPitch && !bUseControllerRotationYaw && !bUseControllerRotationRoll,
 	                   TEXT("These settings are not allowed and must be turned off!"));
 
+	// Must be set before the actor begins play, otherwise the async physics tick will not be registered.
+
+	bAsyncPhysicsTickEnabled = IsValid(Settings) && Settings->Ragdolling.bUseAsyncPhysicsTick;
+
 	Super::BeginPlay();
 
 	// Ignore root motion on simulated proxies, because in some situations it causes
@@ -160,6 +175,8 @@ void AAlsCharacter::BeginPlay()
 	ViewState.NetworkSmoothing.bEnabled |= IsValid(Settings) &&
 		Settings->View.bEnableNetworkSmoothing && GetLocalRole() == ROLE_SimulatedProxy;
 
+	RefreshVisibilityBasedAnimTickOption();
+
 	// Update states to use the initial desired values.
 
 	RefreshRotationMode();
@@ -173,6 +190,40 @@ void AAlsCharacter::BeginPlay()
 	RefreshGait();
 
 	OnOverlayModeChanged(OverlayMode);
+
+	if (GetLocalRole() < ROLE_Authority)
+	{
+		ProcessInitialActionEvents();
+	}
+
+	auto* SignificanceSubsystem{GetWorld()->GetSubsystem<UAlsSignificanceSubsystem>()};
+	if (IsValid(SignificanceSubsystem))
+	{
+		SignificanceSubsystem->RegisterCharacter(this);
+	}
+
+	auto* LocomotionBatchSubsystem{GetWorld()->GetSubsystem<UAlsLocomotionBatchSubsystem>()};
+	if (IsValid(LocomotionBatchSubsystem) && IsValid(Settings) && Settings->bUseBatchedLocomotionRefresh)
+	{
+		LocomotionBatchSubsystem->RegisterCharacter(this);
+	}
+}
+
+void AAlsCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	auto* SignificanceSubsystem{GetWorld()->GetSubsystem<UAlsSignificanceSubsystem>()};
+	if (IsValid(SignificanceSubsystem))
+	{
+		SignificanceSubsystem->UnregisterCharacter(this);
+	}
+
+	auto* LocomotionBatchSubsystem{GetWorld()->GetSubsystem<UAlsLocomotionBatchSubsystem>()};
+	if (IsValid(LocomotionBatchSubsystem))
+	{
+		LocomotionBatchSubsystem->UnregisterCharacter(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AAlsCharacter::PostNetReceiveLocationAndRotation()
@@ -221,6 +272,9 @@ void AAlsCharacter::OnRep_ReplicatedBasedMovement()
 void AAlsCharacter::Tick(const float DeltaTime)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AAlsCharacter::Tick()"), STAT_AAlsCharacter_Tick, STATGROUP_Als)
+	ALS_TRACE_SCOPE(AAlsCharacter_Tick)
+
+	TrySendDesiredState();
 
 	if (!IsValid(Settings) || !AnimationInstance.IsValid())
 	{
@@ -228,22 +282,82 @@ void AAlsCharacter::Tick(const float DeltaTime)
 		return;
 	}
 
-	RefreshVisibilityBasedAnimTickOption();
+	SignificanceState.PendingDeltaTime += DeltaTime;
 
-	RefreshLocomotionLocationAndRotation(DeltaTime);
+	// The view and locomotion may have already been refreshed for this frame by the locomotion batch subsystem.
+
+	const auto bViewAndLocomotionRefreshed{BatchedRefreshFrameNumber == GFrameCounter};
+
+	if (bViewAndLocomotionRefreshed || ShouldRefreshFullTick(SignificanceState.PendingDeltaTime))
+	{
+		RefreshFullTick(SignificanceState.PendingDeltaTime, bViewAndLocomotionRefreshed);
+
+		SignificanceState.PendingDeltaTime = 0.0f;
+	}
+	else
+	{
+		RefreshSkippedTick(DeltaTime);
+	}
+
+	// Must be called after the view refresh, otherwise the sent view rotation is a frame old.
+
+	RefreshCompressedReplication();
+
+	Super::Tick(DeltaTime);
+
+	if (!GetMesh()->bRecentlyRendered &&
+	    GetMesh()->VisibilityBasedAnimTickOption > EVisibilityBasedAnimTickOption::AlwaysTickPose)
+	{
+		AnimationInstance->MarkPendingUpdate();
+	}
+}
+
+void AAlsCharacter::AsyncPhysicsTickActor(const float DeltaTime, const float SimTime)
+{
+	Super::AsyncPhysicsTickActor(DeltaTime, SimTime);
 
-	RefreshView(DeltaTime);
+	RefreshRagdollingPhysicsThread(DeltaTime);
+}
+
+bool AAlsCharacter::ShouldRefreshFullTick(const float PendingDeltaTime) const
+{
+	// Characters that are performing an action are always fully updated, regardless of their significance.
+
+	return LocomotionAction.IsValid() ||
+	       PendingDeltaTime >= Settings->Significance.GetBucketSettings(SignificanceState.Significance).TickInterval;
+}
+
+void AAlsCharacter::RefreshFullTick(const float DeltaTime, const bool bViewAndLocomotionRefreshed)
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshFullTick)
+
+	if (!bViewAndLocomotionRefreshed)
+	{
+		// Discard the view rotation extrapolated on skipped ticks.
+
+		ViewState.Rotation = SignificanceState.ViewRotation;
+
+		RefreshLocomotionLocationAndRotation(DeltaTime);
+
+		RefreshView(DeltaTime);
+	}
 
 	RefreshRotationMode();
 
-	RefreshLocomotion(DeltaTime);
+	if (!bViewAndLocomotionRefreshed)
+	{
+		RefreshLocomotion(DeltaTime);
+	}
 
 	RefreshGait();
 
 	RefreshGroundedRotation(DeltaTime);
 	RefreshInAirRotation(DeltaTime);
 
-	TryStartMantlingInAir();
+	if (Settings->Significance.GetBucketSettings(SignificanceState.Significance).bAllowInAirMantling)
+	{
+		TryStartMantlingInAir();
+	}
 
 	RefreshMantling();
 	RefreshRagdolling(DeltaTime);
@@ -259,13 +373,41 @@ void AAlsCharacter::Tick(const float DeltaTime)
 		RefreshTargetYawAngleUsingLocomotionRotation();
 	}
 
-	Super::Tick(DeltaTime);
+	// Remember the rotation speeds to be able to extrapolate the rotations on skipped ticks.
 
-	if (!GetMesh()->bRecentlyRendered &&
-	    GetMesh()->VisibilityBasedAnimTickOption > EVisibilityBasedAnimTickOption::AlwaysTickPose)
+	if (DeltaTime > SMALL_NUMBER)
 	{
-		AnimationInstance->MarkPendingUpdate();
+		SignificanceState.ViewRotationSpeed = (ViewState.Rotation - SignificanceState.ViewRotation).GetNormalized() * (1.0f / DeltaTime);
 	}
+
+	SignificanceState.ViewRotation = ViewState.Rotation;
+	SignificanceState.YawSpeed = FMath::Abs(LocomotionState.YawSpeed);
+}
+
+void AAlsCharacter::RefreshSkippedTick(const float DeltaTime)
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshSkippedTick)
+
+	// Extrapolate the view and actor rotations using the speeds from the last full tick
+	// so that characters that are not updated every frame still rotate smoothly.
+
+	ViewState.Rotation = (SignificanceState.ViewRotation +
+	                      SignificanceState.ViewRotationSpeed * SignificanceState.PendingDeltaTime).GetNormalized();
+
+	if (!LocomotionState.bRotationLocked && LocomotionMode.IsValid() &&
+	    !HasAnyRootMotion() && !FMath::IsNearlyZero(SignificanceState.YawSpeed))
+	{
+		auto NewActorRotation{GetActorRotation()};
+
+		NewActorRotation.Yaw = UAlsMath::InterpolateAngleConstant(UE_REAL_TO_FLOAT(NewActorRotation.Yaw), LocomotionState.TargetYawAngle,
+		                                                          DeltaTime, SignificanceState.YawSpeed);
+
+		SetActorRotation(NewActorRotation);
+	}
+
+	// The locomotion location and rotation are still refreshed every frame because the animation instance relies on them.
+
+	RefreshLocomotionLocationAndRotation(SignificanceState.PendingDeltaTime);
 }
 
 void AAlsCharacter::PossessedBy(AController* NewController)
@@ -276,6 +418,22 @@ void AAlsCharacter::PossessedBy(AController* NewController)
 
 	ViewState.NetworkSmoothing.bEnabled |= IsValid(Settings) && Settings->View.bEnableListenServerNetworkSmoothing &&
 		IsNetMode(NM_ListenServer) && GetRemoteRole() == ROLE_AutonomousProxy;
+
+	RefreshVisibilityBasedAnimTickOption();
+}
+
+void AAlsCharacter::UnPossessed()
+{
+	Super::UnPossessed();
+
+	RefreshVisibilityBasedAnimTickOption();
+}
+
+void AAlsCharacter::OnRep_Controller()
+{
+	Super::OnRep_Controller();
+
+	RefreshVisibilityBasedAnimTickOption();
 }
 
 void AAlsCharacter::Restart()
@@ -285,18 +443,235 @@ void AAlsCharacter::Restart()
 	ApplyDesiredStance();
 }
 
+void AAlsCharacter::RefreshCompiledState()
+{
+	CompiledState.SetViewMode(ViewMode);
+	CompiledState.SetLocomotionMode(LocomotionMode);
+	CompiledState.SetRotationMode(RotationMode);
+	CompiledState.SetStance(Stance);
+	CompiledState.SetGait(Gait);
+	CompiledState.SetOverlayMode(OverlayMode);
+	CompiledState.SetLocomotionAction(LocomotionAction);
+}
+
+void AAlsCharacter::RefreshDesiredState()
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshDesiredState)
+
+	DesiredState.bAiming = bDesiredAiming;
+	DesiredState.RotationMode = DesiredRotationMode;
+	DesiredState.Stance = DesiredStance;
+	DesiredState.Gait = DesiredGait;
+	DesiredState.ViewMode = ViewMode;
+	DesiredState.OverlayMode = OverlayMode;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, DesiredState, this)
+
+	if (GetLocalRole() >= ROLE_Authority)
+	{
+		ALS_TRACE_NET_SERIALIZE(this, DesiredStateBytes, DesiredState);
+	}
+
+	if (GetLocalRole() == ROLE_AutonomousProxy)
+	{
+		bDesiredStateSendPending = true;
+	}
+}
+
+void AAlsCharacter::TrySendDesiredState()
+{
+	if (bDesiredStateSendPending)
+	{
+		bDesiredStateSendPending = false;
+
+		if (GetLocalRole() == ROLE_AutonomousProxy)
+		{
+			ALS_TRACE_COUNTER_ADD(ServerSetDesiredStateCalls, 1);
+			ALS_TRACE_NET_SERIALIZE(this, DesiredStateBytes, DesiredState);
+			ServerSetDesiredState(DesiredState);
+		}
+	}
+}
+
+void AAlsCharacter::ServerSetDesiredState_Implementation(const FAlsDesiredState& NewState)
+{
+	SetDesiredAiming(NewState.bAiming);
+	SetDesiredRotationMode(NewState.RotationMode);
+	SetDesiredStance(NewState.Stance);
+	SetDesiredGait(NewState.Gait);
+	SetViewMode(NewState.ViewMode);
+	SetOverlayMode(NewState.OverlayMode);
+}
+
+void AAlsCharacter::OnReplicated_DesiredState(const FAlsDesiredState& PreviousState)
+{
+	bDesiredAiming = DesiredState.bAiming;
+	DesiredRotationMode = DesiredState.RotationMode;
+	DesiredStance = DesiredState.Stance;
+	DesiredGait = DesiredState.Gait;
+
+	ViewMode = DesiredState.ViewMode;
+	CompiledState.SetViewMode(ViewMode);
+
+	OverlayMode = DesiredState.OverlayMode;
+	CompiledState.SetOverlayMode(OverlayMode);
+
+	if (bDesiredAiming != PreviousState.bAiming)
+	{
+		OnDesiredAimingChanged(PreviousState.bAiming);
+	}
+
+	if (OverlayMode != PreviousState.OverlayMode)
+	{
+		OnOverlayModeChanged(PreviousState.OverlayMode);
+	}
+}
+
+void AAlsCharacter::AddActionEvent(const FAlsActionEvent& Event)
+{
+	check(GetLocalRole() >= ROLE_Authority)
+
+	ActionEvents.AddEvent(Event);
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ActionEvents, this)
+
+	// Send the event right away, as the reliable multicast RPCs that the action events replaced did.
+
+	ForceNetUpdate();
+
+	ProcessedActionEventSequenceNumber = ActionEvents.SequenceNumber;
+
+	ProcessActionEvent(Event);
+}
+
+void AAlsCharacter::OnReplicated_ActionEvents()
+{
+	// Events received with the initial replication are handled once the character begins play.
+
+	if (!HasActorBegunPlay())
+	{
+		return;
+	}
+
+	// If more events were added since the last update than the ring can hold, then the oldest of them are lost.
+
+	const auto EventsCount{ActionEvents.GetEventsCountSince(ProcessedActionEventSequenceNumber)};
+
+	auto SequenceNumber{static_cast<uint8>(ActionEvents.SequenceNumber - EventsCount)};
+
+	while (SequenceNumber != ActionEvents.SequenceNumber)
+	{
+		SequenceNumber += 1;
+
+		ProcessActionEvent(ActionEvents.GetEvent(SequenceNumber));
+	}
+
+	ProcessedActionEventSequenceNumber = ActionEvents.SequenceNumber;
+}
+
+void AAlsCharacter::ProcessInitialActionEvents()
+{
+	// Restore only the actions that have a lasting effect, since the other actions have most likely already finished.
+
+	const FAlsActionEvent* RotationLockEvent{nullptr};
+	const FAlsActionEvent* RagdollingEvent{nullptr};
+
+	for (auto i{FAlsActionEventsState::Capacity - 1}; i >= 0; i--)
+	{
+		const auto& Event{ActionEvents.GetEvent(static_cast<uint8>(ActionEvents.SequenceNumber - i))};
+
+		if (Event.Type == EAlsActionEventType::LockRotation || Event.Type == EAlsActionEventType::UnLockRotation)
+		{
+			RotationLockEvent = &Event;
+		}
+		else if (Event.Type == EAlsActionEventType::StartRagdolling || Event.Type == EAlsActionEventType::StopRagdolling)
+		{
+			RagdollingEvent = &Event;
+		}
+	}
+
+	ProcessedActionEventSequenceNumber = ActionEvents.SequenceNumber;
+
+	if (RotationLockEvent != nullptr && RotationLockEvent->Type == EAlsActionEventType::LockRotation)
+	{
+		ProcessActionEvent(*RotationLockEvent);
+	}
+
+	if (RagdollingEvent != nullptr && RagdollingEvent->Type == EAlsActionEventType::StartRagdolling)
+	{
+		ProcessActionEvent(*RagdollingEvent);
+	}
+}
+
+void AAlsCharacter::ProcessActionEvent(const FAlsActionEvent& Event)
+{
+	switch (Event.Type)
+	{
+		case EAlsActionEventType::Jump:
+			if (!IsLocallyControlled())
+			{
+				OnJumpedNetworked();
+			}
+			break;
+
+		case EAlsActionEventType::LockRotation:
+			LockRotationImplementation(Event.TargetYawAngle);
+			break;
+
+		case EAlsActionEventType::UnLockRotation:
+			UnLockRotationImplementation();
+			break;
+
+		case EAlsActionEventType::StartRolling:
+			StartRollingImplementation(Event.Montage, Event.PlayRate, Event.StartYawAngle, Event.TargetYawAngle);
+			break;
+
+		case EAlsActionEventType::StartMantling:
+			StartMantlingImplementation(Event.MantlingParameters);
+			break;
+
+		case EAlsActionEventType::StartRagdolling:
+			StartRagdollingImplementation();
+			break;
+
+		case EAlsActionEventType::StopRagdolling:
+			StopRagdollingImplementation();
+			break;
+
+		default:
+			break;
+	}
+}
+
+void AAlsCharacter::SetSignificance(const EAlsSignificance NewSignificance, const float NewViewerDistance)
+{
+	SignificanceState.ViewerDistance = NewViewerDistance;
+
+	if (SignificanceState.Significance != NewSignificance)
+	{
+		SignificanceState.Significance = NewSignificance;
+
+		RefreshVisibilityBasedAnimTickOption();
+	}
+}
+
 void AAlsCharacter::RefreshVisibilityBasedAnimTickOption() const
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshVisibilityBasedAnimTickOption)
+
 	const auto DefaultTickOption{GetClass()->GetDefaultObject<ThisClass>()->GetMesh()->VisibilityBasedAnimTickOption};
 
 	// Make sure that the pose is always ticked on the server when the character is controlled
 	// by a remote client, otherwise some problems may arise (such as jitter when rolling).
 
-	const auto TargetTickOption{
-		IsNetMode(NM_Standalone) || GetLocalRole() <= ROLE_AutonomousProxy || GetRemoteRole() != ROLE_AutonomousProxy
-			? EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered
-			: EVisibilityBasedAnimTickOption::AlwaysTickPose
-	};
+	auto TargetTickOption{EVisibilityBasedAnimTickOption::AlwaysTickPose};
+
+	if (IsNetMode(NM_Standalone) || GetLocalRole() <= ROLE_AutonomousProxy || GetRemoteRole() != ROLE_AutonomousProxy)
+	{
+		TargetTickOption = IsValid(Settings)
+			                   ? Settings->Significance.GetBucketSettings(SignificanceState.Significance).VisibilityBasedAnimTickOption
+			                   : EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+	}
 
 	// Keep the default tick option, at least if the target tick option is not required by the plugin to work properly.
 
@@ -307,22 +682,15 @@ void AAlsCharacter::SetViewMode(const FGameplayTag& NewModeTag)
 {
 	if (ViewMode != NewModeTag)
 	{
-		ViewMode = NewModeTag;
+		ALS_TRACE_STATE_TRANSITION(this, ViewMode, ViewMode, NewModeTag);
 
-		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ViewMode, this)
+		ViewMode = NewModeTag;
+		CompiledState.SetViewMode(NewModeTag);
 
-		if (GetLocalRole() == ROLE_AutonomousProxy)
-		{
-			ServerSetViewMode(NewModeTag);
-		}
+		RefreshDesiredState();
 	}
 }
 
-void AAlsCharacter::ServerSetViewMode_Implementation(const FGameplayTag& NewModeTag)
-{
-	SetViewMode(NewModeTag);
-}
-
 void AAlsCharacter::OnMovementModeChanged(const EMovementMode PreviousMode, const uint8 PreviousCustomMode)
 {
 	// Use the character movement mode to set the locomotion mode to the right value. This allows you to have a
@@ -354,6 +722,7 @@ void AAlsCharacter::SetLocomotionMode(const FGameplayTag& NewModeTag)
 		const auto PreviousMode{LocomotionMode};
 
 		LocomotionMode = NewModeTag;
+		CompiledState.SetLocomotionMode(NewModeTag);
 
 		NotifyLocomotionModeChanged(PreviousMode);
 	}
@@ -361,9 +730,11 @@ void AAlsCharacter::SetLocomotionMode(const FGameplayTag& NewModeTag)
 
 void AAlsCharacter::NotifyLocomotionModeChanged(const FGameplayTag& PreviousModeTag)
 {
+	ALS_TRACE_STATE_TRANSITION(this, LocomotionMode, PreviousModeTag, LocomotionMode);
+
 	ApplyDesiredStance();
 
-	if (LocomotionMode == AlsLocomotionModeTags::Grounded &&
+	if (CompiledState.GetLocomotionMode() == EAlsCompiledLocomotionMode::Grounded &&
 	    PreviousModeTag == AlsLocomotionModeTags::InAir)
 	{
 		if (Settings->Ragdolling.bStartRagdollingOnLand &&
@@ -403,8 +774,8 @@ void AAlsCharacter::NotifyLocomotionModeChanged(const FGameplayTag& PreviousMode
 			LocomotionState.bRotationTowardsLastInputDirectionBlocked = true;
 		}
 	}
-	else if (LocomotionMode == AlsLocomotionModeTags::InAir &&
-	         LocomotionAction == AlsLocomotionActionTags::Rolling &&
+	else if (CompiledState.GetLocomotionMode() == EAlsCompiledLocomotionMode::InAir &&
+	         CompiledState.GetLocomotionAction() == EAlsCompiledLocomotionAction::Rolling &&
 	         Settings->Rolling.bInterruptRollingWhenInAir)
 	{
 		// If the character is currently rolling, then enable ragdolling.
@@ -423,49 +794,24 @@ void AAlsCharacter::SetDesiredAiming(const bool bNewDesiredAiming)
 	{
 		bDesiredAiming = bNewDesiredAiming;
 
-		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, bDesiredAiming, this)
+		RefreshDesiredState();
 
 		OnDesiredAimingChanged(!bNewDesiredAiming);
-
-		if (GetLocalRole() == ROLE_AutonomousProxy)
-		{
-			ServerSetDesiredAiming(bNewDesiredAiming);
-		}
 	}
 }
 
-void AAlsCharacter::OnReplicated_DesiredAiming(const bool bPreviousDesiredAiming)
-{
-	OnDesiredAimingChanged(bPreviousDesiredAiming);
-}
-
 void AAlsCharacter::OnDesiredAimingChanged_Implementation(const bool bPreviousDesiredAiming) {}
 
-void AAlsCharacter::ServerSetDesiredAiming_Implementation(const bool bNewAiming)
-{
-	SetDesiredAiming(bNewAiming);
-}
-
 void AAlsCharacter::SetDesiredRotationMode(const FGameplayTag& NewModeTag)
 {
 	if (DesiredRotationMode != NewModeTag)
 	{
 		DesiredRotationMode = NewModeTag;
 
-		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, DesiredRotationMode, this)
-
-		if (GetLocalRole() == ROLE_AutonomousProxy)
-		{
-			ServerSetDesiredRotationMode(NewModeTag);
-		}
+		RefreshDesiredState();
 	}
 }
 
-void AAlsCharacter::ServerSetDesiredRotationMode_Implementation(const FGameplayTag& NewModeTag)
-{
-	SetDesiredRotationMode(NewModeTag);
-}
-
 void AAlsCharacter::SetRotationMode(const FGameplayTag& NewModeTag)
 {
 	AlsCharacterMovement->SetRotationMode(NewModeTag);
@@ -475,6 +821,9 @@ void AAlsCharacter::SetRotationMode(const FGameplayTag& NewModeTag)
 		const auto PreviousMode{RotationMode};
 
 		RotationMode = NewModeTag;
+		CompiledState.SetRotationMode(NewModeTag);
+
+		ALS_TRACE_STATE_TRANSITION(this, RotationMode, PreviousMode, NewModeTag);
 
 		OnRotationModeChanged(PreviousMode);
 	}
@@ -484,12 +833,14 @@ void AAlsCharacter::OnRotationModeChanged_Implementation(const FGameplayTag& Pre
 
 void AAlsCharacter::RefreshRotationMode()
 {
-	const auto bSprinting{Gait == AlsGaitTags::Sprinting};
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRotationMode)
+
+	const auto bSprinting{CompiledState.GetGait() == EAlsCompiledGait::Sprinting};
 	const auto bAiming{bDesiredAiming || DesiredRotationMode == AlsRotationModeTags::Aiming};
 
-	if (ViewMode == AlsViewModeTags::FirstPerson)
+	if (CompiledState.GetViewMode() == EAlsCompiledViewMode::FirstPerson)
 	{
-		if (LocomotionMode == AlsLocomotionModeTags::InAir)
+		if (CompiledState.GetLocomotionMode() == EAlsCompiledLocomotionMode::InAir)
 		{
 			if (bAiming && Settings->bAllowAimingWhenInAir)
 			{
@@ -519,7 +870,7 @@ void AAlsCharacter::RefreshRotationMode()
 
 	// Third person and other view modes.
 
-	if (LocomotionMode == AlsLocomotionModeTags::InAir)
+	if (CompiledState.GetLocomotionMode() == EAlsCompiledLocomotionMode::InAir)
 	{
 		if (bAiming && Settings->bAllowAimingWhenInAir)
 		{
@@ -577,27 +928,17 @@ void AAlsCharacter::SetDesiredStance(const FGameplayTag& NewStanceTag)
 	{
 		DesiredStance = NewStanceTag;
 
-		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, DesiredStance, this)
-
-		if (GetLocalRole() == ROLE_AutonomousProxy)
-		{
-			ServerSetDesiredStance(NewStanceTag);
-		}
+		RefreshDesiredState();
 
 		ApplyDesiredStance();
 	}
 }
 
-void AAlsCharacter::ServerSetDesiredStance_Implementation(const FGameplayTag& NewStanceTag)
-{
-	SetDesiredStance(NewStanceTag);
-}
-
 void AAlsCharacter::ApplyDesiredStance()
 {
 	if (!LocomotionAction.IsValid())
 	{
-		if (LocomotionMode == AlsLocomotionModeTags::Grounded)
+		if (CompiledState.GetLocomotionMode() == EAlsCompiledLocomotionMode::Grounded)
 		{
 			if (DesiredStance == AlsStanceTags::Standing)
 			{
@@ -608,12 +949,12 @@ void AAlsCharacter::ApplyDesiredStance()
 				Crouch();
 			}
 		}
-		else if (LocomotionMode == AlsLocomotionModeTags::InAir)
+		else if (CompiledState.GetLocomotionMode() == EAlsCompiledLocomotionMode::InAir)
 		{
 			UnCrouch();
 		}
 	}
-	else if (LocomotionAction == AlsLocomotionActionTags::Rolling && Settings->Rolling.bCrouchOnStart)
+	else if (CompiledState.GetLocomotionAction() == EAlsCompiledLocomotionAction::Rolling && Settings->Rolling.bCrouchOnStart)
 	{
 		Crouch();
 	}
@@ -649,6 +990,9 @@ void AAlsCharacter::SetStance(const FGameplayTag& NewStanceTag)
 		const auto PreviousStance{Stance};
 
 		Stance = NewStanceTag;
+		CompiledState.SetStance(NewStanceTag);
+
+		ALS_TRACE_STATE_TRANSITION(this, Stance, PreviousStance, NewStanceTag);
 
 		OnStanceChanged(PreviousStance);
 	}
@@ -662,20 +1006,10 @@ void AAlsCharacter::SetDesiredGait(const FGameplayTag& NewGaitTag)
 	{
 		DesiredGait = NewGaitTag;
 
-		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, DesiredGait, this)
-
-		if (GetLocalRole() == ROLE_AutonomousProxy)
-		{
-			ServerSetDesiredGait(NewGaitTag);
-		}
+		RefreshDesiredState();
 	}
 }
 
-void AAlsCharacter::ServerSetDesiredGait_Implementation(const FGameplayTag& NewGaitTag)
-{
-	SetDesiredGait(NewGaitTag);
-}
-
 void AAlsCharacter::SetGait(const FGameplayTag& NewGaitTag)
 {
 	if (Gait != NewGaitTag)
@@ -683,6 +1017,9 @@ void AAlsCharacter::SetGait(const FGameplayTag& NewGaitTag)
 		const auto PreviousGait{Gait};
 
 		Gait = NewGaitTag;
+		CompiledState.SetGait(NewGaitTag);
+
+		ALS_TRACE_STATE_TRANSITION(this, Gait, PreviousGait, NewGaitTag);
 
 		OnGaitChanged(PreviousGait);
 	}
@@ -692,7 +1029,9 @@ void AAlsCharacter::OnGaitChanged_Implementation(const FGameplayTag& PreviousGai
 
 void AAlsCharacter::RefreshGait()
 {
-	if (LocomotionMode != AlsLocomotionModeTags::Grounded)
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshGait)
+
+	if (CompiledState.GetLocomotionMode() != EAlsCompiledLocomotionMode::Grounded)
 	{
 		return;
 	}
@@ -750,14 +1089,14 @@ bool AAlsCharacter::CanSprint() const
 	// rotation. If the character is in the looking direction rotation mode, only allow sprinting
 	// if there is input and it is facing forward relative to the camera + or - 50 degrees.
 
-	if (!LocomotionState.bHasInput || Stance != AlsStanceTags::Standing ||
+	if (!LocomotionState.bHasInput || CompiledState.GetStance() != EAlsCompiledStance::Standing ||
 	    // ReSharper disable once CppRedundantParentheses
-	    (RotationMode == AlsRotationModeTags::Aiming && !Settings->bSprintHasPriorityOverAiming))
+	    (CompiledState.GetRotationMode() == EAlsCompiledRotationMode::Aiming && !Settings->bSprintHasPriorityOverAiming))
 	{
 		return false;
 	}
 
-	if (ViewMode != AlsViewModeTags::FirstPerson &&
+	if (CompiledState.GetViewMode() != EAlsCompiledViewMode::FirstPerson &&
 	    (DesiredRotationMode == AlsRotationModeTags::VelocityDirection || Settings->bRotateToVelocityWhenSprinting))
 	{
 		return true;
@@ -781,28 +1120,16 @@ void AAlsCharacter::SetOverlayMode(const FGameplayTag& NewModeTag)
 		const auto PreviousMode{OverlayMode};
 
 		OverlayMode = NewModeTag;
+		CompiledState.SetOverlayMode(NewModeTag);
 
-		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, OverlayMode, this)
+		ALS_TRACE_STATE_TRANSITION(this, OverlayMode, PreviousMode, NewModeTag);
 
-		OnOverlayModeChanged(PreviousMode);
+		RefreshDesiredState();
 
-		if (GetLocalRole() == ROLE_AutonomousProxy)
-		{
-			ServerSetOverlayMode(NewModeTag);
-		}
+		OnOverlayModeChanged(PreviousMode);
 	}
 }
 
-void AAlsCharacter::ServerSetOverlayMode_Implementation(const FGameplayTag& NewModeTag)
-{
-	SetOverlayMode(NewModeTag);
-}
-
-void AAlsCharacter::OnReplicated_OverlayMode(const FGameplayTag& PreviousModeTag)
-{
-	OnOverlayModeChanged(PreviousModeTag);
-}
-
 void AAlsCharacter::OnOverlayModeChanged_Implementation(const FGameplayTag& PreviousModeTag) {}
 
 void AAlsCharacter::SetLocomotionAction(const FGameplayTag& NewActionTag)
@@ -812,6 +1139,7 @@ void AAlsCharacter::SetLocomotionAction(const FGameplayTag& NewActionTag)
 		const auto PreviousAction{LocomotionAction};
 
 		LocomotionAction = NewActionTag;
+		CompiledState.SetLocomotionAction(NewActionTag);
 
 		NotifyLocomotionActionChanged(PreviousAction);
 	}
@@ -819,6 +1147,8 @@ void AAlsCharacter::SetLocomotionAction(const FGameplayTag& NewActionTag)
 
 void AAlsCharacter::NotifyLocomotionActionChanged(const FGameplayTag& PreviousActionTag)
 {
+	ALS_TRACE_STATE_TRANSITION(this, LocomotionAction, PreviousActionTag, LocomotionAction);
+
 	ApplyDesiredStance();
 
 	OnLocomotionActionChanged(PreviousActionTag);
@@ -837,6 +1167,13 @@ void AAlsCharacter::SetRawViewRotation(const FRotator& NewViewRotation)
 	{
 		RawViewRotation = NewViewRotation;
 
+		// With the compressed replication, the view rotation is sent and replicated at a limited rate instead.
+
+		if (IsValid(Settings) && Settings->View.bEnableCompressedReplication)
+		{
+			return;
+		}
+
 		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, RawViewRotation, this)
 
 		// The character movement component already sends the view rotation to the
@@ -844,6 +1181,7 @@ void AAlsCharacter::SetRawViewRotation(const FRotator& NewViewRotation)
 
 		if (!IsReplicatingMovement() && GetLocalRole() == ROLE_AutonomousProxy)
 		{
+			ALS_TRACE_COUNTER_ADD(ServerSetRawViewRotationCalls, 1);
 			ServerSetRawViewRotation(NewViewRotation);
 		}
 	}
@@ -854,6 +1192,90 @@ void AAlsCharacter::ServerSetRawViewRotation_Implementation(const FRotator& NewV
 	SetRawViewRotation(NewViewRotation);
 }
 
+void AAlsCharacter::ServerSetRawViewRotationCompressed_Implementation(const uint32 NewCompressedViewRotation)
+{
+	const FRotator NewViewRotation{
+		FRotator::DecompressAxisFromShort(static_cast<uint16>(NewCompressedViewRotation >> 16)),
+		FRotator::DecompressAxisFromShort(static_cast<uint16>(NewCompressedViewRotation & 0xFFFF)),
+		0.0f
+	};
+
+	SetRawViewRotation(NewViewRotation.GetNormalized());
+}
+
+void AAlsCharacter::RefreshCompressedReplication()
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshCompressedReplication)
+
+	if (!Settings->View.bEnableCompressedReplication)
+	{
+		return;
+	}
+
+	const auto WorldTime{GetWorld()->GetTimeSeconds()};
+
+	if (CompressedReplicationPreviousViewRotation != RawViewRotation || CompressedReplicationPreviousInputDirection != InputDirection)
+	{
+		CompressedReplicationPreviousViewRotation = RawViewRotation;
+		CompressedReplicationPreviousInputDirection = InputDirection;
+		CompressedReplicationChangeTime = WorldTime;
+	}
+
+	// Once the values stop changing, they are sent once more right away, ignoring the deadband and the simulated
+	// proxy update rate, so that remote machines don't keep the last values that were sent before they settled.
+
+	const auto bSettled{WorldTime - CompressedReplicationChangeTime >= 1.0f / Settings->View.ServerSendRate};
+
+	if (GetLocalRole() == ROLE_AutonomousProxy)
+	{
+		// The character movement component already sends the view rotation to the
+		// server if the movement is replicated, so we don't have to do it ourselves.
+
+		if (IsReplicatingMovement() || CompressedReplicationViewRotation == RawViewRotation ||
+		    WorldTime - CompressedReplicationTime < 1.0f / Settings->View.ServerSendRate ||
+		    (!bSettled && RawViewRotation.Equals(CompressedReplicationViewRotation, Settings->View.ReplicationDeadbandAngle)))
+		{
+			return;
+		}
+
+		CompressedReplicationTime = WorldTime;
+		CompressedReplicationViewRotation = RawViewRotation;
+
+		ALS_TRACE_COUNTER_ADD(ServerSetRawViewRotationCompressedCalls, 1);
+		ServerSetRawViewRotationCompressed(static_cast<uint32>(FRotator::CompressAxisToShort(RawViewRotation.Pitch)) << 16 |
+		                                   FRotator::CompressAxisToShort(RawViewRotation.Yaw));
+		return;
+	}
+
+	const auto bViewRotationChanged{CompressedReplicationViewRotation != RawViewRotation};
+	const auto bInputDirectionChanged{CompressedReplicationInputDirection != InputDirection};
+
+	if (GetLocalRole() < ROLE_Authority || (!bViewRotationChanged && !bInputDirectionChanged) ||
+	    (!bSettled &&
+	     WorldTime - CompressedReplicationTime < 1.0f / Settings->View.CalculateProxyUpdateRate(SignificanceState.ViewerDistance)))
+	{
+		return;
+	}
+
+	// Relies on the push model replication, properties that are not marked as dirty are not replicated even if they have changed.
+
+	CompressedReplicationTime = WorldTime;
+
+	if (bViewRotationChanged)
+	{
+		CompressedReplicationViewRotation = RawViewRotation;
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, RawViewRotation, this)
+	}
+
+	if (bInputDirectionChanged)
+	{
+		CompressedReplicationInputDirection = InputDirection;
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, InputDirection, this)
+	}
+}
+
 void AAlsCharacter::OnReplicated_RawViewRotation()
 {
 	CorrectViewNetworkSmoothing(RawViewRotation);
@@ -872,6 +1294,7 @@ void AAlsCharacter::CorrectViewNetworkSmoothing(const FRotator& NewViewRotation)
 	{
 		NetworkSmoothing.InitialRotation = RawViewRotation;
 		NetworkSmoothing.Rotation = RawViewRotation;
+		NetworkSmoothing.Buffer.Reset();
 		return;
 	}
 
@@ -890,6 +1313,15 @@ void AAlsCharacter::CorrectViewNetworkSmoothing(const FRotator& NewViewRotation)
 
 	NetworkSmoothing.InitialRotation = NetworkSmoothing.Rotation;
 
+	if (IsValid(Settings) && Settings->View.bEnableNetworkSmoothingBuffer)
+	{
+		NetworkSmoothing.Buffer.AddSample(NewNetworkSmoothingServerTime, RawViewRotation);
+	}
+	else
+	{
+		NetworkSmoothing.Buffer.Reset();
+	}
+
 	// Using server time lets us know how much time elapsed, regardless of packet lag variance.
 
 	const auto ServerDeltaTime{NewNetworkSmoothingServerTime - NetworkSmoothing.ServerTime};
@@ -919,7 +1351,7 @@ void AAlsCharacter::CorrectViewNetworkSmoothing(const FRotator& NewViewRotation)
 	NetworkSmoothing.Duration = NetworkSmoothing.ServerTime - NetworkSmoothing.ClientTime;
 }
 
-void AAlsCharacter::RefreshView(const float DeltaTime)
+void AAlsCharacter::PrepareViewRefresh()
 {
 	ViewState.PreviousYawAngle = UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw);
 
@@ -928,50 +1360,86 @@ void AAlsCharacter::RefreshView(const float DeltaTime)
 	{
 		SetRawViewRotation(Super::GetViewRotation().GetNormalized());
 	}
+}
+
+void AAlsCharacter::RefreshView(const float DeltaTime)
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshView)
+
+	PrepareViewRefresh();
 
 	RefreshViewNetworkSmoothing(DeltaTime);
 
 	ViewState.Rotation = ViewState.NetworkSmoothing.Rotation;
+	ViewState.YawSpeed = CalculateViewYawSpeed(ViewState.Rotation, ViewState.PreviousYawAngle, DeltaTime);
+}
 
-	// Set the yaw speed by comparing the current and previous view yaw angle, divided by
-	// delta seconds. This represents the speed the camera is rotating from left to right.
+void AAlsCharacter::RefreshViewNetworkSmoothing(const float DeltaTime)
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshViewNetworkSmoothing)
+
+	auto& NetworkSmoothing{ViewState.NetworkSmoothing};
 
-	ViewState.YawSpeed = FMath::Abs(UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw) - ViewState.PreviousYawAngle) / DeltaTime;
+	const auto bAllowNetworkSmoothing{
+		NetworkSmoothing.bEnabled && Settings->Significance.GetBucketSettings(SignificanceState.Significance).bAllowViewNetworkSmoothing
+	};
+
+	const auto* Buffer{
+		Settings->View.bEnableNetworkSmoothingBuffer && NetworkSmoothing.Buffer.SamplesCount > 0 ? &NetworkSmoothing.Buffer : nullptr
+	};
+
+	RefreshViewNetworkSmoothingRotation(bAllowNetworkSmoothing, Buffer, Settings->View.NetworkSmoothingMaxExtrapolationTime,
+	                                    NetworkSmoothing.ServerTime, NetworkSmoothing.Duration, RawViewRotation, DeltaTime,
+	                                    NetworkSmoothing.ClientTime, NetworkSmoothing.InitialRotation, NetworkSmoothing.Rotation);
 }
 
-void AAlsCharacter::RefreshViewNetworkSmoothing(const float DeltaTime)
+void AAlsCharacter::RefreshViewNetworkSmoothingRotation(const bool bAllowNetworkSmoothing, const FAlsViewNetworkSmoothingBuffer* Buffer,
+                                                        const float MaxExtrapolationTime, const float ServerTime, const float Duration,
+                                                        const FRotator& RawViewRotation, const float DeltaTime, float& ClientTime,
+                                                        FRotator& InitialRotation, FRotator& Rotation)
 {
 	// Based on UCharacterMovementComponent::SmoothClientPosition_Interpolate()
 	// and UCharacterMovementComponent::SmoothClientPosition_UpdateVisuals().
 
-	auto& NetworkSmoothing{ViewState.NetworkSmoothing};
+	if (bAllowNetworkSmoothing && Buffer != nullptr)
+	{
+		// The client time is allowed to run past the last server time while the rotation is extrapolated.
+
+		ClientTime = FMath::Min(ClientTime + DeltaTime, Buffer->GetEndServerTime(MaxExtrapolationTime));
+		Rotation = Buffer->Evaluate(ClientTime, MaxExtrapolationTime);
+		return;
+	}
 
-	if (!NetworkSmoothing.bEnabled ||
-	    NetworkSmoothing.ClientTime >= NetworkSmoothing.ServerTime ||
-	    NetworkSmoothing.Duration <= SMALL_NUMBER)
+	if (!bAllowNetworkSmoothing || ClientTime >= ServerTime || Duration <= SMALL_NUMBER)
 	{
-		NetworkSmoothing.InitialRotation = RawViewRotation;
-		NetworkSmoothing.Rotation = RawViewRotation;
+		InitialRotation = RawViewRotation;
+		Rotation = RawViewRotation;
 		return;
 	}
 
-	NetworkSmoothing.ClientTime += DeltaTime;
+	ClientTime += DeltaTime;
 
-	const auto InterpolationAmount{
-		UAlsMath::Clamp01(1.0f - (NetworkSmoothing.ServerTime - NetworkSmoothing.ClientTime) / NetworkSmoothing.Duration)
-	};
+	const auto InterpolationAmount{UAlsMath::Clamp01(1.0f - (ServerTime - ClientTime) / Duration)};
 
 	if (!FAnimWeight::IsFullWeight(InterpolationAmount))
 	{
-		NetworkSmoothing.Rotation = UAlsMath::LerpRotator(NetworkSmoothing.InitialRotation, RawViewRotation, InterpolationAmount);
+		Rotation = UAlsMath::LerpRotator(InitialRotation, RawViewRotation, InterpolationAmount);
 	}
 	else
 	{
-		NetworkSmoothing.ClientTime = NetworkSmoothing.ServerTime;
-		NetworkSmoothing.Rotation = RawViewRotation;
+		ClientTime = ServerTime;
+		Rotation = RawViewRotation;
 	}
 }
 
+float AAlsCharacter::CalculateViewYawSpeed(const FRotator& Rotation, const float PreviousYawAngle, const float DeltaTime)
+{
+	// Set the yaw speed by comparing the current and previous view yaw angle, divided by
+	// delta seconds. This represents the speed the camera is rotating from left to right.
+
+	return FMath::Abs(UE_REAL_TO_FLOAT(Rotation.Yaw) - PreviousYawAngle) / DeltaTime;
+}
+
 void AAlsCharacter::SetInputDirection(FVector NewInputDirection)
 {
 	NewInputDirection = NewInputDirection.GetSafeNormal();
@@ -980,12 +1448,17 @@ void AAlsCharacter::SetInputDirection(FVector NewInputDirection)
 	{
 		InputDirection = NewInputDirection;
 
-		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, InputDirection, this)
+		if (!IsValid(Settings) || !Settings->View.bEnableCompressedReplication)
+		{
+			MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, InputDirection, this)
+		}
 	}
 }
 
 void AAlsCharacter::RefreshLocomotionLocationAndRotation(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshLocomotionLocationAndRotation)
+
 	const auto& ActorTransform{GetActorTransform()};
 
 	// If network smoothing is disabled, then return regular actor transform.
@@ -1020,7 +1493,7 @@ void AAlsCharacter::RefreshLocomotionLocationAndRotation(const float DeltaTime)
 	                                                     LocomotionState.PreviousYawAngle) / DeltaTime;
 }
 
-void AAlsCharacter::RefreshLocomotion(const float DeltaTime)
+void AAlsCharacter::PrepareLocomotionRefresh()
 {
 	LocomotionState.PreviousVelocity = LocomotionState.Velocity;
 	LocomotionState.PreviousYawAngle = UE_REAL_TO_FLOAT(LocomotionState.Rotation.Yaw);
@@ -1030,43 +1503,60 @@ void AAlsCharacter::RefreshLocomotion(const float DeltaTime)
 		SetInputDirection(GetCharacterMovement()->GetCurrentAcceleration() / GetCharacterMovement()->GetMaxAcceleration());
 	}
 
+	LocomotionState.Velocity = GetVelocity();
+}
+
+void AAlsCharacter::RefreshLocomotion(const float DeltaTime)
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshLocomotion)
+
+	PrepareLocomotionRefresh();
+
+	RefreshLocomotionMovement(InputDirection, LocomotionState.Velocity, LocomotionState.PreviousVelocity,
+	                          Settings->MovingSpeedThreshold, DeltaTime, LocomotionState.bHasInput, LocomotionState.InputYawAngle,
+	                          LocomotionState.bHasSpeed, LocomotionState.Speed, LocomotionState.VelocityYawAngle,
+	                          LocomotionState.Acceleration, LocomotionState.bMoving);
+}
+
+void AAlsCharacter::RefreshLocomotionMovement(const FVector& InputDirection, const FVector& Velocity, const FVector& PreviousVelocity,
+                                              const float MovingSpeedThreshold, const float DeltaTime, bool& bHasInput,
+                                              float& InputYawAngle, bool& bHasSpeed, float& Speed, float& VelocityYawAngle,
+                                              FVector& Acceleration, bool& bMoving)
+{
 	// If the character has the input, update the input yaw angle.
 
-	LocomotionState.bHasInput = InputDirection.SizeSquared() > KINDA_SMALL_NUMBER;
+	bHasInput = InputDirection.SizeSquared() > KINDA_SMALL_NUMBER;
 
-	if (LocomotionState.bHasInput)
+	if (bHasInput)
 	{
-		LocomotionState.InputYawAngle = UE_REAL_TO_FLOAT(UAlsMath::DirectionToAngleXY(InputDirection));
+		InputYawAngle = UE_REAL_TO_FLOAT(UAlsMath::DirectionToAngleXY<FAlsFastTrigonometry>(InputDirection));
 	}
 
-	LocomotionState.Velocity = GetVelocity();
-
 	// Determine if the character is moving by getting its speed. The speed equals the length
 	// of the horizontal velocity, so it does not take vertical movement into account. If the
 	// character is moving, update the last velocity rotation. This value is saved because it might
 	// be useful to know the last orientation of a movement even after the character has stopped.
 
-	LocomotionState.Speed = UE_REAL_TO_FLOAT(LocomotionState.Velocity.Size2D());
-	LocomotionState.bHasSpeed = LocomotionState.Speed >= 1.0f;
+	Speed = UE_REAL_TO_FLOAT(Velocity.Size2D());
+	bHasSpeed = Speed >= 1.0f;
 
-	if (LocomotionState.bHasSpeed)
+	if (bHasSpeed)
 	{
-		LocomotionState.VelocityYawAngle = UE_REAL_TO_FLOAT(UAlsMath::DirectionToAngleXY(LocomotionState.Velocity));
+		VelocityYawAngle = UE_REAL_TO_FLOAT(UAlsMath::DirectionToAngleXY<FAlsFastTrigonometry>(Velocity));
 	}
 
-	LocomotionState.Acceleration = (LocomotionState.Velocity - LocomotionState.PreviousVelocity) / DeltaTime;
+	Acceleration = (Velocity - PreviousVelocity) / DeltaTime;
 
 	// Character is moving if has speed and current acceleration, or if the speed is greater than the moving speed threshold.
 
 	// ReSharper disable once CppRedundantParentheses
-	LocomotionState.bMoving = (LocomotionState.bHasInput && LocomotionState.bHasSpeed) ||
-	                          LocomotionState.Speed > Settings->MovingSpeedThreshold;
+	bMoving = (bHasInput && bHasSpeed) || Speed > MovingSpeedThreshold;
 }
 
 void AAlsCharacter::Jump()
 {
-	if (Stance == AlsStanceTags::Standing && !LocomotionAction.IsValid() &&
-	    LocomotionMode == AlsLocomotionModeTags::Grounded)
+	if (CompiledState.GetStance() == EAlsCompiledStance::Standing && !LocomotionAction.IsValid() &&
+	    CompiledState.GetLocomotionMode() == EAlsCompiledLocomotionMode::Grounded)
 	{
 		Super::Jump();
 	}
@@ -1083,15 +1573,10 @@ void AAlsCharacter::OnJumped_Implementation()
 
 	if (GetLocalRole() >= ROLE_Authority)
 	{
-		MulticastOnJumpedNetworked();
-	}
-}
+		FAlsActionEvent Event;
+		Event.Type = EAlsActionEventType::Jump;
 
-void AAlsCharacter::MulticastOnJumpedNetworked_Implementation()
-{
-	if (!IsLocallyControlled())
-	{
-		OnJumpedNetworked();
+		AddActionEvent(Event);
 	}
 }
 
@@ -1115,8 +1600,10 @@ void AAlsCharacter::PhysicsRotation(const float DeltaTime)
 
 void AAlsCharacter::RefreshGroundedRotation(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshGroundedRotation)
+
 	if (LocomotionState.bRotationLocked || LocomotionAction.IsValid() ||
-	    LocomotionMode != AlsLocomotionModeTags::Grounded)
+	    CompiledState.GetLocomotionMode() != EAlsCompiledLocomotionMode::Grounded)
 	{
 		return;
 	}
@@ -1138,13 +1625,14 @@ void AAlsCharacter::RefreshGroundedRotation(const float DeltaTime)
 			return;
 		}
 
-		if (RotationMode == AlsRotationModeTags::Aiming || ViewMode == AlsViewModeTags::FirstPerson)
+		if (CompiledState.GetRotationMode() == EAlsCompiledRotationMode::Aiming ||
+		    CompiledState.GetViewMode() == EAlsCompiledViewMode::FirstPerson)
 		{
 			RefreshGroundedNotMovingAimingRotation(DeltaTime);
 			return;
 		}
 
-		if (RotationMode == AlsRotationModeTags::VelocityDirection)
+		if (CompiledState.GetRotationMode() == EAlsCompiledRotationMode::VelocityDirection)
 		{
 			// Rotate to the last target yaw angle when not moving.
 
@@ -1167,7 +1655,7 @@ void AAlsCharacter::RefreshGroundedRotation(const float DeltaTime)
 		return;
 	}
 
-	if (RotationMode == AlsRotationModeTags::VelocityDirection &&
+	if (CompiledState.GetRotationMode() == EAlsCompiledRotationMode::VelocityDirection &&
 	    (LocomotionState.bHasInput || !LocomotionState.bRotationTowardsLastInputDirectionBlocked))
 	{
 		LocomotionState.bRotationTowardsLastInputDirectionBlocked = false;
@@ -1179,10 +1667,10 @@ void AAlsCharacter::RefreshGroundedRotation(const float DeltaTime)
 		return;
 	}
 
-	if (RotationMode == AlsRotationModeTags::LookingDirection)
+	if (CompiledState.GetRotationMode() == EAlsCompiledRotationMode::LookingDirection)
 	{
 		const auto TargetYawAngle{
-			Gait == AlsGaitTags::Sprinting
+			CompiledState.GetGait() == EAlsCompiledGait::Sprinting
 				? LocomotionState.VelocityYawAngle
 				: UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw) +
 				  GetMesh()->GetAnimInstance()->GetCurveValue(UAlsConstants::RotationYawOffsetCurve())
@@ -1194,7 +1682,7 @@ void AAlsCharacter::RefreshGroundedRotation(const float DeltaTime)
 		return;
 	}
 
-	if (RotationMode == AlsRotationModeTags::Aiming)
+	if (CompiledState.GetRotationMode() == EAlsCompiledRotationMode::Aiming)
 	{
 		RefreshGroundedMovingAimingRotation(DeltaTime);
 		return;
@@ -1215,6 +1703,8 @@ bool AAlsCharacter::TryRefreshCustomGroundedNotMovingRotation(const float DeltaT
 
 void AAlsCharacter::RefreshGroundedMovingAimingRotation(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshGroundedMovingAimingRotation)
+
 	static constexpr auto RotationInterpolationSpeed{20.0f};
 	static constexpr auto TargetYawAngleRotationSpeed{1000.0f};
 
@@ -1224,6 +1714,8 @@ void AAlsCharacter::RefreshGroundedMovingAimingRotation(const float DeltaTime)
 
 void AAlsCharacter::RefreshGroundedNotMovingAimingRotation(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshGroundedNotMovingAimingRotation)
+
 	static constexpr auto RotationInterpolationSpeed{20.0f};
 
 	if (LocomotionState.bHasInput)
@@ -1269,8 +1761,10 @@ float AAlsCharacter::CalculateRotationInterpolationSpeed() const
 	static constexpr auto ReferenceViewYawSpeed{300.0f};
 	static constexpr auto InterpolationSpeedMultiplier{3.0f};
 
-	return AlsCharacterMovement->GetGaitSettings().RotationInterpolationSpeedCurve
-	                           ->GetFloatValue(AlsCharacterMovement->CalculateGaitAmount()) *
+	const auto& GaitSettings{AlsCharacterMovement->GetGaitSettings()};
+
+	return GaitSettings.BakedRotationInterpolationSpeedCurve.Evaluate(GaitSettings.RotationInterpolationSpeedCurve,
+	                                                                  AlsCharacterMovement->CalculateGaitAmount()) *
 	       UAlsMath::LerpClamped(1.0f, InterpolationSpeedMultiplier, ViewState.YawSpeed / ReferenceViewYawSpeed);
 }
 
@@ -1291,8 +1785,10 @@ void AAlsCharacter::ApplyRotationYawSpeed(const float DeltaTime)
 
 void AAlsCharacter::RefreshInAirRotation(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshInAirRotation)
+
 	if (LocomotionState.bRotationLocked || LocomotionAction.IsValid() ||
-	    LocomotionMode != AlsLocomotionModeTags::InAir)
+	    CompiledState.GetLocomotionMode() != EAlsCompiledLocomotionMode::InAir)
 	{
 		return;
 	}
@@ -1304,7 +1800,8 @@ void AAlsCharacter::RefreshInAirRotation(const float DeltaTime)
 
 	static constexpr auto RotationInterpolationSpeed{5.0f};
 
-	if (RotationMode == AlsRotationModeTags::VelocityDirection || RotationMode == AlsRotationModeTags::LookingDirection)
+	if (CompiledState.GetRotationMode() == EAlsCompiledRotationMode::VelocityDirection ||
+	    CompiledState.GetRotationMode() == EAlsCompiledRotationMode::LookingDirection)
 	{
 		switch (Settings->InAirRotationMode)
 		{
@@ -1330,7 +1827,7 @@ void AAlsCharacter::RefreshInAirRotation(const float DeltaTime)
 				break;
 		}
 	}
-	else if (RotationMode == AlsRotationModeTags::Aiming)
+	else if (CompiledState.GetRotationMode() == EAlsCompiledRotationMode::Aiming)
 	{
 		RefreshInAirAimingRotation(DeltaTime);
 	}
@@ -1347,6 +1844,8 @@ bool AAlsCharacter::TryRefreshCustomInAirRotation(const float DeltaTime)
 
 void AAlsCharacter::RefreshInAirAimingRotation(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshInAirAimingRotation)
+
 	static constexpr auto RotationInterpolationSpeed{15.0f};
 
 	RefreshRotation(UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw), DeltaTime, RotationInterpolationSpeed);
@@ -1354,6 +1853,8 @@ void AAlsCharacter::RefreshInAirAimingRotation(const float DeltaTime)
 
 void AAlsCharacter::RefreshRotation(const float TargetYawAngle, const float DeltaTime, const float RotationInterpolationSpeed)
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRotation)
+
 	RefreshTargetYawAngle(TargetYawAngle);
 
 	auto NewRotation{GetActorRotation()};
@@ -1369,6 +1870,8 @@ void AAlsCharacter::RefreshRotationExtraSmooth(const float TargetYawAngle, const
                                                const float RotationInterpolationSpeed,
                                                const float TargetYawAngleRotationSpeed)
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRotationExtraSmooth)
+
 	LocomotionState.TargetYawAngle = TargetYawAngle;
 
 	RefreshViewRelativeTargetYawAngle();
@@ -1389,6 +1892,8 @@ void AAlsCharacter::RefreshRotationExtraSmooth(const float TargetYawAngle, const
 
 void AAlsCharacter::RefreshRotationInstant(const float TargetYawAngle, const ETeleportType Teleport)
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRotationInstant)
+
 	RefreshTargetYawAngle(TargetYawAngle);
 
 	auto NewRotation{GetActorRotation()};
@@ -1427,7 +1932,18 @@ void AAlsCharacter::LockRotation(const float TargetYawAngle)
 		return;
 	}
 
-	MulticastLockRotation(TargetYawAngle);
+	if (GetLocalRole() >= ROLE_Authority)
+	{
+		FAlsActionEvent Event;
+		Event.Type = EAlsActionEventType::LockRotation;
+		Event.TargetYawAngle = TargetYawAngle;
+
+		AddActionEvent(Event);
+	}
+	else
+	{
+		LockRotationImplementation(TargetYawAngle);
+	}
 }
 
 void AAlsCharacter::UnLockRotation()
@@ -1438,17 +1954,27 @@ void AAlsCharacter::UnLockRotation()
 		return;
 	}
 
-	MulticastUnLockRotation();
+	if (GetLocalRole() >= ROLE_Authority)
+	{
+		FAlsActionEvent Event;
+		Event.Type = EAlsActionEventType::UnLockRotation;
+
+		AddActionEvent(Event);
+	}
+	else
+	{
+		UnLockRotationImplementation();
+	}
 }
 
-void AAlsCharacter::MulticastLockRotation_Implementation(const float TargetYawAngle)
+void AAlsCharacter::LockRotationImplementation(const float TargetYawAngle)
 {
 	LocomotionState.bRotationLocked = true;
 
 	RefreshRotationInstant(TargetYawAngle, ETeleportType::TeleportPhysics);
 }
 
-void AAlsCharacter::MulticastUnLockRotation_Implementation()
+void AAlsCharacter::UnLockRotationImplementation()
 {
 	LocomotionState.bRotationLocked = false;
 }
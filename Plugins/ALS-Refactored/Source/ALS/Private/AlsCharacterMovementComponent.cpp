@@ -6,6 +6,7 @@
 #include "Curves/CurveVector.h"
 #include "GameFramework/Controller.h"
 #include "Utility/AlsMacros.h"
+#include "Utility/AlsTrace.h"
 
 void FAlsCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& Move, const ENetworkMoveType MoveType)
 {
@@ -194,7 +195,8 @@ float UAlsCharacterMovementComponent::GetMaxAcceleration() const
 	// Get the acceleration using the movement curve. This allows for fine control over movement behavior at each speed.
 
 	return IsMovingOnGround() && ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve))
-		       ? GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[0].Eval(CalculateGaitAmount())
+		       ? GaitSettings.BakedAccelerationAndDecelerationAndGroundFrictionCurve.Evaluate(
+			       GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve, 0, CalculateGaitAmount())
 		       : Super::GetMaxAcceleration();
 }
 
@@ -203,7 +205,8 @@ float UAlsCharacterMovementComponent::GetMaxBrakingDeceleration() const
 	// Get the deceleration using the movement curve. This allows for fine control over movement behavior at each speed.
 
 	return IsMovingOnGround() && ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve))
-		       ? GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[1].Eval(CalculateGaitAmount())
+		       ? GaitSettings.BakedAccelerationAndDecelerationAndGroundFrictionCurve.Evaluate(
+			       GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve, 1, CalculateGaitAmount())
 		       : Super::GetMaxBrakingDeceleration();
 }
 
@@ -234,7 +237,8 @@ void UAlsCharacterMovementComponent::PhysWalking(const float DeltaTime, int32 It
 	{
 		// Get the ground friction using the movement curve. This allows for fine control over movement behavior at each speed.
 
-		GroundFriction = GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[2].Eval(CalculateGaitAmount());
+		GroundFriction = GaitSettings.BakedAccelerationAndDecelerationAndGroundFrictionCurve.Evaluate(
+			GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve, 2, CalculateGaitAmount());
 	}
 
 	// TODO Copied with modifications from UCharacterMovementComponent::PhysWalking().
@@ -479,7 +483,8 @@ void UAlsCharacterMovementComponent::PhysNavWalking(const float DeltaTime, const
 	{
 		// Get the ground friction using the movement curve. This allows for fine control over movement behavior at each speed.
 
-		GroundFriction = GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[2].Eval(CalculateGaitAmount());
+		GroundFriction = GaitSettings.BakedAccelerationAndDecelerationAndGroundFrictionCurve.Evaluate(
+			GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve, 2, CalculateGaitAmount());
 	}
 
 	Super::PhysNavWalking(DeltaTime, Iterations);
@@ -512,6 +517,8 @@ void UAlsCharacterMovementComponent::PhysCustom(const float DeltaTime, int32 Ite
 
 void UAlsCharacterMovementComponent::PerformMovement(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(UAlsCharacterMovementComponent_PerformMovement)
+
 	Super::PerformMovement(DeltaTime);
 
 	// Update the ServerLastTransformUpdateTimeStamp when the control rotation
@@ -783,6 +790,8 @@ void UAlsCharacterMovementComponent::SetMovementSettings(UAlsMovementSettings* N
 
 void UAlsCharacterMovementComponent::RefreshGaitSettings()
 {
+	ALS_TRACE_SCOPE(UAlsCharacterMovementComponent_RefreshGaitSettings)
+
 	if (ALS_ENSURE(IsValid(MovementSettings)))
 	{
 		GaitSettings = *MovementSettings->RotationModes.Find(RotationMode)->Stances.Find(Stance);
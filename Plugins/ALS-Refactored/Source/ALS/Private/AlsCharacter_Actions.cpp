@@ -2,6 +2,9 @@
 
 #include "AlsAnimationInstance.h"
 #include "AlsCharacterMovementComponent.h"
+#include "AlsLedgeIndex.h"
+#include "AlsLedgeIndexSubsystem.h"
+#include "AlsPhysicsQuerySubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "Animation/AnimInstance.h"
 #include "Components/CapsuleComponent.h"
@@ -9,17 +12,57 @@
 #include "Engine/CollisionProfile.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/GameStateBase.h"
+#include "Misc/ScopeLock.h"
 #include "Net/Core/PushModel/PushModel.h"
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
 #include "RootMotionSources/AlsRootMotionSource_Mantling.h"
 #include "Settings/AlsCharacterSettings.h"
 #include "Utility/AlsConstants.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsMath.h"
+#include "Utility/AlsTrace.h"
 #include "Utility/AlsUtility.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ragdolls"), STAT_AlsRagdolling_Ragdolls, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sleeping Ragdolls"), STAT_AlsRagdolling_Sleeping, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reduced Simulation Ragdolls"), STAT_AlsRagdolling_ReducedSimulation, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ragdoll Motor Updates"), STAT_AlsRagdolling_MotorUpdates, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mantling Traces"), STAT_AlsMantling_Traces, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Mantling Traces"), STAT_AlsMantling_AsyncTraces, STATGROUP_Als)
+
+namespace AlsRagdollingConstants
+{
+	static constexpr auto PullForce{750.0f};
+	static constexpr auto PullForceInterpolationSpeed{0.6f};
+}
+
+namespace AlsRagdolling
+{
+	static Chaos::FRigidBodyHandle_Internal* GetPhysicsThreadHandle(FSingleParticlePhysicsProxy* BodyProxy)
+	{
+		auto* BodyHandle{BodyProxy != nullptr ? BodyProxy->GetPhysicsThreadAPI() : nullptr};
+
+		return BodyHandle != nullptr && BodyHandle->ObjectState() == Chaos::EObjectStateType::Dynamic ? BodyHandle : nullptr;
+	}
+}
+
+namespace AlsMantling
+{
+	static FCollisionObjectQueryParams MakeObjectQueryParameters(const FAlsGeneralMantlingSettings& MantlingSettings)
+	{
+		FCollisionObjectQueryParams ObjectQueryParameters;
+		for (const auto ObjectType : MantlingSettings.MantlingTraceObjectTypes)
+		{
+			ObjectQueryParameters.AddObjectTypesToQuery(UCollisionProfile::Get()->ConvertToCollisionChannel(false, ObjectType));
+		}
+
+		return ObjectQueryParameters;
+	}
+}
+
 void AAlsCharacter::TryStartRolling(const float PlayRate)
 {
-	if (LocomotionMode == AlsLocomotionModeTags::Grounded)
+	if (CompiledState.GetLocomotionMode() == EAlsCompiledLocomotionMode::Grounded)
 	{
 		StartRolling(PlayRate, Settings->Rolling.bRotateToInputOnStart && LocomotionState.bHasInput
 			                       ? LocomotionState.InputYawAngle
@@ -31,7 +74,7 @@ bool AAlsCharacter::IsRollingAllowedToStart(const UAnimMontage* Montage) const
 {
 	return !LocomotionAction.IsValid() ||
 	       // ReSharper disable once CppRedundantParentheses
-	       (LocomotionAction == AlsLocomotionActionTags::Rolling &&
+	       (CompiledState.GetLocomotionAction() == EAlsCompiledLocomotionAction::Rolling &&
 	        !GetMesh()->GetAnimInstance()->Montage_IsPlaying(Montage));
 }
 
@@ -53,13 +96,21 @@ void AAlsCharacter::StartRolling(const float PlayRate, const float TargetYawAngl
 
 	if (GetLocalRole() >= ROLE_Authority)
 	{
-		MulticastStartRolling(Montage, PlayRate, StartYawAngle, TargetYawAngle);
+		FAlsActionEvent Event;
+		Event.Type = EAlsActionEventType::StartRolling;
+		Event.Montage = Montage;
+		Event.PlayRate = PlayRate;
+		Event.StartYawAngle = StartYawAngle;
+		Event.TargetYawAngle = TargetYawAngle;
+
+		AddActionEvent(Event);
 	}
 	else
 	{
 		GetCharacterMovement()->FlushServerMoves();
 
 		StartRollingImplementation(Montage, PlayRate, StartYawAngle, TargetYawAngle);
+		ALS_TRACE_COUNTER_ADD(ServerStartRollingCalls, 1);
 		ServerStartRolling(Montage, PlayRate, StartYawAngle, TargetYawAngle);
 	}
 }
@@ -74,17 +125,17 @@ void AAlsCharacter::ServerStartRolling_Implementation(UAnimMontage* Montage, con
 {
 	if (IsRollingAllowedToStart(Montage))
 	{
-		MulticastStartRolling(Montage, PlayRate, StartYawAngle, TargetYawAngle);
-		ForceNetUpdate();
+		FAlsActionEvent Event;
+		Event.Type = EAlsActionEventType::StartRolling;
+		Event.Montage = Montage;
+		Event.PlayRate = PlayRate;
+		Event.StartYawAngle = StartYawAngle;
+		Event.TargetYawAngle = TargetYawAngle;
+
+		AddActionEvent(Event);
 	}
 }
 
-void AAlsCharacter::MulticastStartRolling_Implementation(UAnimMontage* Montage, const float PlayRate,
-                                                         const float StartYawAngle, const float TargetYawAngle)
-{
-	StartRollingImplementation(Montage, PlayRate, StartYawAngle, TargetYawAngle);
-}
-
 void AAlsCharacter::StartRollingImplementation(UAnimMontage* Montage, const float PlayRate,
                                                const float StartYawAngle, const float TargetYawAngle)
 {
@@ -100,6 +151,8 @@ void AAlsCharacter::StartRollingImplementation(UAnimMontage* Montage, const floa
 
 void AAlsCharacter::RefreshRolling(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRolling)
+
 	if (GetLocalRole() <= ROLE_SimulatedProxy ||
 	    GetMesh()->GetAnimInstance()->RootMotionMode <= ERootMotionMode::IgnoreRootMotion)
 	{
@@ -112,7 +165,9 @@ void AAlsCharacter::RefreshRolling(const float DeltaTime)
 
 void AAlsCharacter::RefreshRollingPhysics(const float DeltaTime)
 {
-	if (LocomotionAction != AlsLocomotionActionTags::Rolling)
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRollingPhysics)
+
+	if (CompiledState.GetLocomotionAction() != EAlsCompiledLocomotionAction::Rolling)
 	{
 		return;
 	}
@@ -137,14 +192,139 @@ void AAlsCharacter::RefreshRollingPhysics(const float DeltaTime)
 
 bool AAlsCharacter::TryStartMantlingGrounded()
 {
-	return LocomotionMode == AlsLocomotionModeTags::Grounded &&
+	return CompiledState.GetLocomotionMode() == EAlsCompiledLocomotionMode::Grounded &&
 	       TryStartMantling(Settings->Mantling.GroundedTrace);
 }
 
 bool AAlsCharacter::TryStartMantlingInAir()
 {
-	return LocomotionMode == AlsLocomotionModeTags::InAir && IsLocallyControlled() &&
-	       TryStartMantling(Settings->Mantling.InAirTrace);
+	if (CompiledState.GetLocomotionMode() != EAlsCompiledLocomotionMode::InAir || !IsLocallyControlled())
+	{
+		MantlingState.InAirForwardTraceHandle = {};
+		return false;
+	}
+
+	return Settings->Mantling.InAirScheduler.bEnabled
+		       ? TryStartMantlingInAirScheduled()
+		       : TryStartMantling(Settings->Mantling.InAirTrace);
+}
+
+bool AAlsCharacter::TryStartMantlingInAirScheduled()
+{
+	const auto& TraceSettings{Settings->Mantling.InAirTrace};
+	const auto& SchedulerSettings{Settings->Mantling.InAirScheduler};
+
+	auto* World{GetWorld()};
+	const auto WorldTime{World->GetTimeSeconds()};
+
+	// Fetch the result of the asynchronous forward trace requested in the previous frame.
+
+	FTraceDatum TraceDatum;
+	const auto bForwardTraceCompleted{
+		MantlingState.InAirForwardTraceHandle.IsValid() && World->QueryTraceData(MantlingState.InAirForwardTraceHandle, TraceDatum)
+	};
+
+	MantlingState.InAirForwardTraceHandle = {};
+
+	// Cheap preconditions first. Without them, the traces can't succeed, so there is no need to perform them.
+
+	FVector ForwardTraceDirection;
+	if ((SchedulerSettings.bRequireInput && !LocomotionState.bHasInput) ||
+	    !CalculateMantlingForwardTraceDirection(ForwardTraceDirection))
+	{
+		return false;
+	}
+
+	const auto ObjectQueryParameters{AlsMantling::MakeObjectQueryParameters(Settings->Mantling)};
+
+	auto bTracesAllowed{true};
+	if (TryStartMantlingFromLedgeIndex(TraceSettings, ForwardTraceDirection, ObjectQueryParameters, bTracesAllowed))
+	{
+		return true;
+	}
+
+	if (!bTracesAllowed)
+	{
+		return false;
+	}
+
+	const auto* Capsule{GetCapsuleComponent()};
+
+	const auto CapsuleScale{Capsule->GetComponentScale().Z};
+	const auto CapsuleRadius{Capsule->GetScaledCapsuleRadius()};
+
+	const auto ForwardTraceStart{CalculateMantlingForwardTraceStart(TraceSettings, ForwardTraceDirection)};
+	const auto ForwardTraceReachDistance{UE_REAL_TO_FLOAT(CapsuleRadius + (TraceSettings.ReachDistance + 1.0f) * CapsuleScale)};
+
+	const auto HorizontalSpeed{UE_REAL_TO_FLOAT(LocomotionState.Velocity.Size2D())};
+
+	const auto MinCheckInterval{UE_REAL_TO_FLOAT(SchedulerSettings.CheckInterval.X)};
+	const auto MaxCheckInterval{UE_REAL_TO_FLOAT(SchedulerSettings.CheckInterval.Y)};
+
+	if (bForwardTraceCompleted)
+	{
+		// The trace was performed from the previous frame's location and is longer than the reach distance, so first
+		// check if the obstacle it found is within reach from the current location. Then use the remaining distance
+		// to the obstacle and the vertical speed to decide when the next check should be performed.
+
+		const auto* ForwardTraceHit{
+			TraceDatum.OutHits.Num() > 0 && TraceDatum.OutHits[0].bBlockingHit ? &TraceDatum.OutHits[0] : nullptr
+		};
+
+		auto ObstacleDistance{UE_REAL_TO_FLOAT((TraceDatum.End - TraceDatum.Start).Size()) - ForwardTraceReachDistance};
+
+		if (ForwardTraceHit != nullptr)
+		{
+			ObstacleDistance = UE_REAL_TO_FLOAT((ForwardTraceHit->Location - ForwardTraceStart) | ForwardTraceDirection) -
+			                   ForwardTraceReachDistance;
+
+			if (ObstacleDistance <= 0.0f && TryStartMantlingFromForwardTraceHit(TraceSettings, *ForwardTraceHit, ObjectQueryParameters))
+			{
+				return true;
+			}
+		}
+
+		const auto ObstacleTime{
+			HorizontalSpeed > UE_KINDA_SMALL_NUMBER ? FMath::Max(0.0f, ObstacleDistance) / HorizontalSpeed : MaxCheckInterval
+		};
+
+		// Time during which a ledge stays within the mantling height range while the character is falling or rising.
+
+		const auto VerticalSpeed{FMath::Abs(UE_REAL_TO_FLOAT(LocomotionState.Velocity.Z))};
+
+		const auto LedgeHeightTime{
+			VerticalSpeed > UE_KINDA_SMALL_NUMBER
+				? UE_REAL_TO_FLOAT((TraceSettings.LedgeHeight.GetMax() - TraceSettings.LedgeHeight.GetMin()) * CapsuleScale) / VerticalSpeed
+				: MaxCheckInterval
+		};
+
+		MantlingState.InAirNextCheckTime = WorldTime + FMath::Clamp(FMath::Min(ObstacleTime, LedgeHeightTime) * 0.5f,
+		                                                            MinCheckInterval, MaxCheckInterval);
+	}
+
+	if (WorldTime < MantlingState.InAirNextCheckTime ||
+	    !UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(World, EAlsPhysicsQueryCategory::Mantling, SignificanceState.Significance))
+	{
+		return false;
+	}
+
+	// Extend the trace by the distance the character can travel until the next check, so that the result can
+	// be used to tell how far the nearest obstacle is. The result will be available in the next frame.
+
+	static const FName ForwardTraceTag{FString::Format(TEXT("{0} (Forward Trace)"), {ANSI_TO_TCHAR(__FUNCTION__)})};
+
+	const auto ForwardTraceEnd{
+		ForwardTraceStart + ForwardTraceDirection * (ForwardTraceReachDistance + HorizontalSpeed * MaxCheckInterval)
+	};
+
+	MantlingState.InAirForwardTraceHandle = World->AsyncSweepByObjectType(
+		EAsyncTraceType::Single, ForwardTraceStart, ForwardTraceEnd, FQuat::Identity, ObjectQueryParameters,
+		FCollisionShape::MakeCapsule(CapsuleRadius - 1.0f, CalculateMantlingForwardTraceCapsuleHalfHeight(TraceSettings)),
+		{ForwardTraceTag, false, this});
+
+	INC_DWORD_STAT(STAT_AlsMantling_AsyncTraces);
+
+	return false;
 }
 
 bool AAlsCharacter::IsMantlingAllowedToStart_Implementation() const
@@ -152,14 +332,13 @@ bool AAlsCharacter::IsMantlingAllowedToStart_Implementation() const
 	return !LocomotionAction.IsValid();
 }
 
-bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSettings)
+bool AAlsCharacter::CalculateMantlingForwardTraceDirection(FVector& ForwardTraceDirection) const
 {
 	if (!Settings->Mantling.bAllowMantling || GetLocalRole() <= ROLE_SimulatedProxy || !IsMantlingAllowedToStart())
 	{
 		return false;
 	}
 
-	const auto ActorLocation{GetActorLocation()};
 	const auto ActorYawAngle{UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(GetActorRotation().Yaw))};
 
 	float ForwardTraceAngle;
@@ -182,20 +361,85 @@ bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSetti
 		return false;
 	}
 
-	FCollisionObjectQueryParams ObjectQueryParameters;
-	for (const auto ObjectType : Settings->Mantling.MantlingTraceObjectTypes)
+	ForwardTraceDirection = UAlsMath::AngleToDirectionXY<FAlsFastTrigonometry>(
+		ActorYawAngle + FMath::ClampAngle(ForwardTraceDeltaAngle, -Settings->Mantling.MaxReachAngle, Settings->Mantling.MaxReachAngle));
+
+	return true;
+}
+
+FVector AAlsCharacter::CalculateMantlingForwardTraceStart(const FAlsMantlingTraceSettings& TraceSettings,
+                                                          const FVector& ForwardTraceDirection) const
+{
+	const auto* Capsule{GetCapsuleComponent()};
+
+	auto ForwardTraceStart{GetActorLocation() - ForwardTraceDirection * Capsule->GetScaledCapsuleRadius()};
+	ForwardTraceStart.Z += (TraceSettings.LedgeHeight.X + TraceSettings.LedgeHeight.Y) * 0.5f * Capsule->GetComponentScale().Z -
+		UCharacterMovementComponent::MAX_FLOOR_DIST - Capsule->GetScaledCapsuleHalfHeight();
+
+	return ForwardTraceStart;
+}
+
+float AAlsCharacter::CalculateMantlingForwardTraceCapsuleHalfHeight(const FAlsMantlingTraceSettings& TraceSettings) const
+{
+	return UE_REAL_TO_FLOAT((TraceSettings.LedgeHeight.GetMax() - TraceSettings.LedgeHeight.GetMin()) *
+	                        GetCapsuleComponent()->GetComponentScale().Z) * 0.5f;
+}
+
+bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSettings)
+{
+	FVector ForwardTraceDirection;
+	if (!CalculateMantlingForwardTraceDirection(ForwardTraceDirection))
 	{
-		ObjectQueryParameters.AddObjectTypesToQuery(UCollisionProfile::Get()->ConvertToCollisionChannel(false, ObjectType));
+		return false;
+	}
+
+	const auto ObjectQueryParameters{AlsMantling::MakeObjectQueryParameters(Settings->Mantling)};
+
+	auto bTracesAllowed{true};
+	if (TryStartMantlingFromLedgeIndex(TraceSettings, ForwardTraceDirection, ObjectQueryParameters, bTracesAllowed))
+	{
+		return true;
 	}
 
-	const auto ForwardTraceDirection{
-		UAlsMath::AngleToDirectionXY(
-			ActorYawAngle + FMath::ClampAngle(ForwardTraceDeltaAngle, -Settings->Mantling.MaxReachAngle, Settings->Mantling.MaxReachAngle))
+	if (!bTracesAllowed)
+	{
+		return false;
+	}
+
+	if (!UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(GetWorld(), EAlsPhysicsQueryCategory::Mantling, SignificanceState.Significance))
+	{
+		return false;
+	}
+
+	// Trace forward to find an object the character cannot walk on.
+
+	static const FName ForwardTraceTag{FString::Format(TEXT("{0} (Forward Trace)"), {ANSI_TO_TCHAR(__FUNCTION__)})};
+
+	const auto* Capsule{GetCapsuleComponent()};
+
+	const auto CapsuleScale{Capsule->GetComponentScale().Z};
+	const auto CapsuleRadius{Capsule->GetScaledCapsuleRadius()};
+
+	const auto ForwardTraceStart{CalculateMantlingForwardTraceStart(TraceSettings, ForwardTraceDirection)};
+	const auto ForwardTraceEnd{
+		ForwardTraceStart + ForwardTraceDirection * (CapsuleRadius + (TraceSettings.ReachDistance + 1.0f) * CapsuleScale)
 	};
 
-#if ENABLE_DRAW_DEBUG
-	const auto bDisplayDebug{UAlsUtility::ShouldDisplayDebug(this, UAlsConstants::MantlingDisplayName())};
-#endif
+	FHitResult ForwardTraceHit;
+	GetWorld()->SweepSingleByObjectType(ForwardTraceHit, ForwardTraceStart, ForwardTraceEnd, FQuat::Identity, ObjectQueryParameters,
+	                                    FCollisionShape::MakeCapsule(CapsuleRadius - 1.0f,
+	                                                                 CalculateMantlingForwardTraceCapsuleHalfHeight(TraceSettings)),
+	                                    {ForwardTraceTag, false, this});
+
+	INC_DWORD_STAT(STAT_AlsMantling_Traces);
+
+	return TryStartMantlingFromForwardTraceHit(TraceSettings, ForwardTraceHit, ObjectQueryParameters);
+}
+
+bool AAlsCharacter::TryStartMantlingFromForwardTraceHit(const FAlsMantlingTraceSettings& TraceSettings, const FHitResult& ForwardTraceHit,
+                                                        const FCollisionObjectQueryParams& ObjectQueryParameters)
+{
+	const auto ActorLocation{GetActorLocation()};
 
 	const auto* Capsule{GetCapsuleComponent()};
 
@@ -209,22 +453,14 @@ bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSetti
 
 	const auto LedgeHeightDelta{UE_REAL_TO_FLOAT((TraceSettings.LedgeHeight.GetMax() - TraceSettings.LedgeHeight.GetMin()) * CapsuleScale)};
 
-	// Trace forward to find an object the character cannot walk on.
-
-	static const FName ForwardTraceTag{FString::Format(TEXT("{0} (Forward Trace)"), {ANSI_TO_TCHAR(__FUNCTION__)})};
-
-	auto ForwardTraceStart{CapsuleBottomLocation - ForwardTraceDirection * CapsuleRadius};
-	ForwardTraceStart.Z += (TraceSettings.LedgeHeight.X + TraceSettings.LedgeHeight.Y) *
-		0.5f * CapsuleScale - UCharacterMovementComponent::MAX_FLOOR_DIST;
+#if ENABLE_DRAW_DEBUG
+	const auto bDisplayDebug{UAlsUtility::ShouldDisplayDebug(this, UAlsConstants::MantlingDisplayName())};
 
-	auto ForwardTraceEnd{ForwardTraceStart + ForwardTraceDirection * (CapsuleRadius + (TraceSettings.ReachDistance + 1.0f) * CapsuleScale)};
+	const FVector ForwardTraceStart{ForwardTraceHit.TraceStart};
+	const FVector ForwardTraceEnd{ForwardTraceHit.TraceEnd};
 
 	const auto ForwardTraceCapsuleHalfHeight{LedgeHeightDelta * 0.5f};
-
-	FHitResult ForwardTraceHit;
-	GetWorld()->SweepSingleByObjectType(ForwardTraceHit, ForwardTraceStart, ForwardTraceEnd, FQuat::Identity, ObjectQueryParameters,
-	                                    FCollisionShape::MakeCapsule(TraceCapsuleRadius, ForwardTraceCapsuleHalfHeight),
-	                                    {ForwardTraceTag, false, this});
+#endif
 
 	auto* TargetPrimitive{ForwardTraceHit.GetComponent()};
 
@@ -272,6 +508,10 @@ bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSetti
 	                                    ObjectQueryParameters, FCollisionShape::MakeSphere(TraceCapsuleRadius),
 	                                    {DownwardTraceTag, false, this});
 
+	UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(GetWorld(), EAlsPhysicsQueryCategory::Mantling,
+	                                                  SignificanceState.Significance, false);
+	INC_DWORD_STAT(STAT_AlsMantling_Traces);
+
 	if (!GetCharacterMovement()->IsWalkable(DownwardTraceHit))
 	{
 #if ENABLE_DRAW_DEBUG
@@ -303,6 +543,10 @@ bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSetti
 
 	const FVector TargetCapsuleLocation{TargetLocation.X, TargetLocation.Y, TargetLocation.Z + CapsuleHalfHeight};
 
+	UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(GetWorld(), EAlsPhysicsQueryCategory::Mantling,
+	                                                  SignificanceState.Significance, false);
+	INC_DWORD_STAT(STAT_AlsMantling_Traces);
+
 	if (GetWorld()->OverlapAnyTestByObjectType(TargetCapsuleLocation, FQuat::Identity, ObjectQueryParameters,
 	                                           FCollisionShape::MakeCapsule(CapsuleRadius, CapsuleHalfHeight),
 	                                           {FreeSpaceTraceTag, false, this}))
@@ -341,14 +585,170 @@ bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSetti
 
 	const auto TargetRotation{(-ForwardTraceHit.ImpactNormal.GetSafeNormal2D()).ToOrientationQuat()};
 
+	StartMantling(TargetPrimitive, TargetLocation, TargetRotation,
+	              UE_REAL_TO_FLOAT((TargetLocation.Z - CapsuleBottomLocation.Z) / CapsuleScale));
+
+	return true;
+}
+
+bool AAlsCharacter::TryStartMantlingFromLedgeIndex(const FAlsMantlingTraceSettings& TraceSettings, const FVector& ForwardTraceDirection,
+                                                   const FCollisionObjectQueryParams& ObjectQueryParameters, bool& bTracesAllowed)
+{
+	if (!Settings->Mantling.bUseLedgeIndex)
+	{
+		return false;
+	}
+
+	const auto ActorLocation{GetActorLocation()};
+	const auto* Capsule{GetCapsuleComponent()};
+
+	const auto CapsuleScale{Capsule->GetComponentScale().Z};
+	const auto CapsuleRadius{Capsule->GetScaledCapsuleRadius()};
+	const auto CapsuleHalfHeight{Capsule->GetScaledCapsuleHalfHeight()};
+
+	const FVector CapsuleBottomLocation{ActorLocation.X, ActorLocation.Y, ActorLocation.Z - CapsuleHalfHeight};
+
+	const auto* LedgeIndexSubsystem{GetWorld()->GetSubsystem<UAlsLedgeIndexSubsystem>()};
+
+	if (!IsValid(LedgeIndexSubsystem) || !LedgeIndexSubsystem->IsLocationCovered(CapsuleBottomLocation))
+	{
+		return false;
+	}
+
+	bTracesAllowed = Settings->Mantling.bFallBackToTracesWithLedgeIndex;
+
+	const auto TraceCapsuleRadius{CapsuleRadius - 1.0f};
+
+	// Same reach and height range as the forward trace in AAlsCharacter::TryStartMantling().
+
+	FVector LedgeLocation;
+	const auto* Ledge{
+		LedgeIndexSubsystem->FindMantlingLedge(CapsuleBottomLocation, ForwardTraceDirection,
+		                                       CapsuleRadius + (TraceSettings.ReachDistance + 1.0f) * CapsuleScale,
+		                                       {
+			                                       UE_REAL_TO_FLOAT(TraceSettings.LedgeHeight.GetMin() * CapsuleScale),
+			                                       UE_REAL_TO_FLOAT(TraceSettings.LedgeHeight.GetMax() * CapsuleScale)
+		                                       },
+		                                       Settings->Mantling.MaxReachAngle, LedgeLocation)
+	};
+
+	if (Ledge == nullptr)
+	{
+		return false;
+	}
+
+	// Sweep the character's capsule downward onto the ledge top. A single sweep confirms that the ledge
+	// still exists, that its top is walkable, and that the character has room to stand on it.
+
+	if (!UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(GetWorld(), EAlsPhysicsQueryCategory::Mantling, SignificanceState.Significance))
+	{
+		return false;
+	}
+
+	static const FName LedgeTraceTag{FString::Format(TEXT("{0} (Ledge Trace)"), {ANSI_TO_TCHAR(__FUNCTION__)})};
+
+	const auto TargetLocationOffset{Ledge->Normal * (TraceSettings.TargetLocationOffset * CapsuleScale)};
+
+	const FVector LedgeTraceStart{
+		LedgeLocation.X - TargetLocationOffset.X,
+		LedgeLocation.Y - TargetLocationOffset.Y,
+		LedgeLocation.Z + CapsuleHalfHeight + TraceCapsuleRadius
+	};
+
+	const FVector LedgeTraceEnd{LedgeTraceStart.X, LedgeTraceStart.Y, LedgeLocation.Z + CapsuleHalfHeight - TraceCapsuleRadius};
+
+	FHitResult LedgeTraceHit;
+	GetWorld()->SweepSingleByObjectType(LedgeTraceHit, LedgeTraceStart, LedgeTraceEnd, FQuat::Identity, ObjectQueryParameters,
+	                                    FCollisionShape::MakeCapsule(CapsuleRadius, CapsuleHalfHeight),
+	                                    {LedgeTraceTag, false, this});
+
+	INC_DWORD_STAT(STAT_AlsMantling_Traces);
+
+	auto* TargetPrimitive{LedgeTraceHit.GetComponent()};
+
+	const auto bLedgeValid{
+		!LedgeTraceHit.bStartPenetrating && GetCharacterMovement()->IsWalkable(LedgeTraceHit) && IsValid(TargetPrimitive) &&
+		TargetPrimitive->GetComponentVelocity().SizeSquared() <= FMath::Square(Settings->Mantling.TargetPrimitiveSpeedThreshold) &&
+		TargetPrimitive->CanCharacterStepUp(this)
+	};
+
+#if ENABLE_DRAW_DEBUG
+	if (UAlsUtility::ShouldDisplayDebug(this, UAlsConstants::MantlingDisplayName()))
+	{
+		UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), LedgeTraceStart, LedgeTraceEnd, CapsuleRadius, CapsuleHalfHeight,
+		                                                    bLedgeValid, LedgeTraceHit, {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f},
+		                                                    bLedgeValid || TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+	}
+#endif
+
+	if (!bLedgeValid)
+	{
+		return false;
+	}
+
+	// The index contains only the static geometry, so make sure that nothing stands between the character
+	// and the ledge wall, same as the forward trace in AAlsCharacter::TryStartMantling() does.
+
+	static const FName ClearanceTraceTag{FString::Format(TEXT("{0} (Clearance Trace)"), {ANSI_TO_TCHAR(__FUNCTION__)})};
+
+	const auto ClearanceTraceStart{CalculateMantlingForwardTraceStart(TraceSettings, -Ledge->Normal)};
+
+	const auto ClearanceTraceDistance{
+		UE_REAL_TO_FLOAT((ClearanceTraceStart - LedgeLocation) | Ledge->Normal) - TraceCapsuleRadius - 1.0f
+	};
+
+	if (ClearanceTraceDistance > 0.0f)
+	{
+		const auto ClearanceTraceEnd{ClearanceTraceStart - Ledge->Normal * ClearanceTraceDistance};
+
+		UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(GetWorld(), EAlsPhysicsQueryCategory::Mantling,
+		                                                  SignificanceState.Significance, false);
+		INC_DWORD_STAT(STAT_AlsMantling_Traces);
+
+		FHitResult ClearanceTraceHit;
+		if (GetWorld()->SweepSingleByObjectType(ClearanceTraceHit, ClearanceTraceStart, ClearanceTraceEnd, FQuat::Identity,
+		                                        ObjectQueryParameters,
+		                                        FCollisionShape::MakeCapsule(TraceCapsuleRadius,
+		                                                                     CalculateMantlingForwardTraceCapsuleHalfHeight(TraceSettings)),
+		                                        {ClearanceTraceTag, false, this}))
+		{
+#if ENABLE_DRAW_DEBUG
+			if (UAlsUtility::ShouldDisplayDebug(this, UAlsConstants::MantlingDisplayName()))
+			{
+				UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), ClearanceTraceStart, ClearanceTraceEnd, TraceCapsuleRadius,
+				                                                    CalculateMantlingForwardTraceCapsuleHalfHeight(TraceSettings), true,
+				                                                    ClearanceTraceHit, {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f},
+				                                                    TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+			}
+#endif
+
+			return false;
+		}
+	}
+
+	const FVector TargetLocation{
+		LedgeTraceStart.X,
+		LedgeTraceStart.Y,
+		LedgeTraceHit.Location.Z - CapsuleHalfHeight + UCharacterMovementComponent::MIN_FLOOR_DIST
+	};
+
+	StartMantling(TargetPrimitive, TargetLocation, (-Ledge->Normal).ToOrientationQuat(),
+	              UE_REAL_TO_FLOAT((TargetLocation.Z - CapsuleBottomLocation.Z) / CapsuleScale));
+
+	return true;
+}
+
+void AAlsCharacter::StartMantling(UPrimitiveComponent* TargetPrimitive, const FVector& TargetLocation,
+                                  const FQuat& TargetRotation, const float MantlingHeight)
+{
 	FAlsMantlingParameters Parameters;
 
 	Parameters.TargetPrimitive = TargetPrimitive;
-	Parameters.MantlingHeight = UE_REAL_TO_FLOAT((TargetLocation.Z - CapsuleBottomLocation.Z) / CapsuleScale);
+	Parameters.MantlingHeight = MantlingHeight;
 
 	// Determine the mantling type by checking the movement mode and mantling height.
 
-	Parameters.MantlingType = LocomotionMode != AlsLocomotionModeTags::Grounded
+	Parameters.MantlingType = CompiledState.GetLocomotionMode() != EAlsCompiledLocomotionMode::Grounded
 		                          ? EAlsMantlingType::InAir
 		                          : Parameters.MantlingHeight > Settings->Mantling.MantlingHighHeightThreshold
 		                          ? EAlsMantlingType::High
@@ -374,13 +774,18 @@ bool AAlsCharacter::TryStartMantling(const FAlsMantlingTraceSettings& TraceSetti
 
 	if (GetLocalRole() >= ROLE_Authority)
 	{
-		MulticastStartMantling(Parameters);
+		FAlsActionEvent Event;
+		Event.Type = EAlsActionEventType::StartMantling;
+		Event.MantlingParameters = Parameters;
+
+		AddActionEvent(Event);
 	}
 	else
 	{
 		GetCharacterMovement()->FlushServerMoves();
 
 		StartMantlingImplementation(Parameters);
+		ALS_TRACE_COUNTER_ADD(ServerStartMantlingCalls, 1);
 		ServerStartMantling(Parameters);
 	}
 
@@ -391,14 +796,12 @@ void AAlsCharacter::ServerStartMantling_Implementation(const FAlsMantlingParamet
 {
 	if (IsMantlingAllowedToStart())
 	{
-		MulticastStartMantling(Parameters);
-		ForceNetUpdate();
-	}
-}
+		FAlsActionEvent Event;
+		Event.Type = EAlsActionEventType::StartMantling;
+		Event.MantlingParameters = Parameters;
 
-void AAlsCharacter::MulticastStartMantling_Implementation(const FAlsMantlingParameters& Parameters)
-{
-	StartMantlingImplementation(Parameters);
+		AddActionEvent(Event);
+	}
 }
 
 void AAlsCharacter::StartMantlingImplementation(const FAlsMantlingParameters& Parameters)
@@ -472,6 +875,11 @@ void AAlsCharacter::StartMantlingImplementation(const FAlsMantlingParameters& Pa
 
 	MantlingRootMotionSourceId = GetCharacterMovement()->ApplyRootMotionSource(Mantling);
 
+	if (GetLocalRole() >= ROLE_Authority)
+	{
+		ALS_TRACE_NET_SERIALIZE(this, MantlingRootMotionSourceBytes, *Mantling);
+	}
+
 	// Play the animation montage if valid.
 
 	if (ALS_ENSURE(IsValid(MantlingSettings->Montage)))
@@ -505,6 +913,8 @@ void AAlsCharacter::OnMantlingStarted_Implementation(const FAlsMantlingParameter
 
 void AAlsCharacter::RefreshMantling()
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshMantling)
+
 	if (MantlingRootMotionSourceId <= 0)
 	{
 		return;
@@ -516,7 +926,7 @@ void AAlsCharacter::RefreshMantling()
 	    RootMotionSource->Status.HasFlag(ERootMotionSourceStatusFlags::Finished) ||
 	    RootMotionSource->Status.HasFlag(ERootMotionSourceStatusFlags::MarkedForRemoval) ||
 	    // ReSharper disable once CppRedundantParentheses
-	    (LocomotionAction.IsValid() && LocomotionAction != AlsLocomotionActionTags::Mantling) ||
+	    (LocomotionAction.IsValid() && CompiledState.GetLocomotionAction() != EAlsCompiledLocomotionAction::Mantling) ||
 	    GetCharacterMovement()->MovementMode != MOVE_Custom)
 	{
 		StopMantling();
@@ -557,7 +967,7 @@ void AAlsCharacter::OnMantlingEnded_Implementation() {}
 
 bool AAlsCharacter::IsRagdollingAllowedToStart() const
 {
-	return LocomotionAction != AlsLocomotionActionTags::Ragdolling;
+	return CompiledState.GetLocomotionAction() != EAlsCompiledLocomotionAction::Ragdolling;
 }
 
 void AAlsCharacter::StartRagdolling()
@@ -569,12 +979,16 @@ void AAlsCharacter::StartRagdolling()
 
 	if (GetLocalRole() >= ROLE_Authority)
 	{
-		MulticastStartRagdolling();
+		FAlsActionEvent Event;
+		Event.Type = EAlsActionEventType::StartRagdolling;
+
+		AddActionEvent(Event);
 	}
 	else
 	{
 		GetCharacterMovement()->FlushServerMoves();
 
+		ALS_TRACE_COUNTER_ADD(ServerStartRagdollingCalls, 1);
 		ServerStartRagdolling();
 	}
 }
@@ -583,14 +997,11 @@ void AAlsCharacter::ServerStartRagdolling_Implementation()
 {
 	if (IsRagdollingAllowedToStart())
 	{
-		MulticastStartRagdolling();
-		ForceNetUpdate();
-	}
-}
+		FAlsActionEvent Event;
+		Event.Type = EAlsActionEventType::StartRagdolling;
 
-void AAlsCharacter::MulticastStartRagdolling_Implementation()
-{
-	StartRagdollingImplementation();
+		AddActionEvent(Event);
+	}
 }
 
 void AAlsCharacter::StartRagdollingImplementation()
@@ -649,6 +1060,41 @@ void AAlsCharacter::StartRagdollingImplementation()
 	RagdollingState.PullForce = 0.0f;
 	RagdollingState.bPendingFinalization = false;
 
+	if (Settings->Ragdolling.bUseAsyncPhysicsTick)
+	{
+		RefreshRagdollingAsyncBodies();
+
+		// The speed limit is applied on the async physics tick for the same number of physics steps.
+
+		FScopeLock Lock{&RagdollingAsyncStateLock};
+
+		RagdollingAsyncState.bActive = true;
+		RagdollingAsyncState.bApplyPullForce = false;
+		RagdollingAsyncState.PullForceBoneName = NAME_None;
+		RagdollingAsyncState.PullForceBodyProxy = nullptr;
+		RagdollingAsyncState.SpeedLimitFrameTimeRemaining = RagdollingState.SpeedLimitFrameTimeRemaining;
+		RagdollingAsyncState.SpeedLimit = RagdollingState.SpeedLimit;
+		RagdollingAsyncState.PullForce = 0.0f;
+
+		RagdollingState.SpeedLimitFrameTimeRemaining = 0;
+	}
+
+	RagdollingState.SnapshotDelay = 0.0f;
+	RagdollingState.bPhysicsSuspended = false;
+	RagdollingState.bSnapshotBodiesKinematic = false;
+	RagdollingState.bReducedSimulation = false;
+	RagdollingState.SettledTime = 0.0f;
+	RagdollingState.bSleeping = false;
+	RagdollingState.MotorStiffness = -1.0f;
+	RagdollingState.GroundDistance = -1.0f;
+
+	if (!IsLocallyControlled())
+	{
+		// Don't blend toward the snapshot left over from the previous ragdolling, the pull force is used until a new one is received.
+
+		RagdollSnapshot.Bodies.Reset();
+	}
+
 	if (GetLocalRole() >= ROLE_AutonomousProxy)
 	{
 		SetRagdollTargetLocation(GetMesh()->GetSocketLocation(UAlsConstants::PelvisBone()));
@@ -669,6 +1115,7 @@ void AAlsCharacter::SetRagdollTargetLocation(const FVector& NewLocation)
 
 		if (GetLocalRole() == ROLE_AutonomousProxy)
 		{
+			ALS_TRACE_COUNTER_ADD(ServerSetRagdollTargetLocationCalls, 1);
 			ServerSetRagdollTargetLocation(NewLocation);
 		}
 	}
@@ -679,13 +1126,182 @@ void AAlsCharacter::ServerSetRagdollTargetLocation_Implementation(const FVector_
 	SetRagdollTargetLocation(NewLocation);
 }
 
+void AAlsCharacter::SetRagdollSnapshot(const FAlsRagdollSnapshot& NewSnapshot)
+{
+	RagdollSnapshot = NewSnapshot;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, RagdollSnapshot, this)
+
+	if (GetLocalRole() >= ROLE_Authority)
+	{
+		ALS_TRACE_NET_SERIALIZE(this, RagdollSnapshotBytes, RagdollSnapshot);
+	}
+	else if (GetLocalRole() == ROLE_AutonomousProxy)
+	{
+		ALS_TRACE_COUNTER_ADD(ServerSetRagdollSnapshotCalls, 1);
+		ALS_TRACE_NET_SERIALIZE(this, RagdollSnapshotBytes, RagdollSnapshot);
+		ServerSetRagdollSnapshot(NewSnapshot);
+	}
+}
+
+void AAlsCharacter::ServerSetRagdollSnapshot_Implementation(const FAlsRagdollSnapshot& NewSnapshot)
+{
+	SetRagdollSnapshot(NewSnapshot);
+}
+
+void AAlsCharacter::CaptureRagdollSnapshot(const float DeltaTime)
+{
+	RagdollingState.SnapshotDelay -= DeltaTime;
+
+	if (RagdollingState.SnapshotDelay > 0.0f)
+	{
+		return;
+	}
+
+	// A ragdoll at rest needs far fewer snapshots than a ragdoll that is still tumbling.
+
+	RagdollingState.SnapshotDelay = 1.0f / Settings->Ragdolling.CalculateSnapshotSendRate(
+		                                UE_REAL_TO_FLOAT(RagdollingState.RootBoneVelocity.Size()));
+
+	const auto& SnapshotBones{Settings->Ragdolling.SnapshotBones};
+	const auto BodiesCount{FMath::Min(SnapshotBones.Num(), static_cast<int32>(FAlsRagdollSnapshot::MaxBodies))};
+
+	FAlsRagdollSnapshot NewSnapshot;
+	NewSnapshot.Bodies.Reserve(BodiesCount);
+
+	for (auto i{0}; i < BodiesCount; i++)
+	{
+		const auto BoneTransform{GetMesh()->GetSocketTransform(SnapshotBones[i])};
+
+		auto& Body{NewSnapshot.Bodies.AddDefaulted_GetRef()};
+		Body.Location = BoneTransform.GetLocation();
+		Body.Rotation = BoneTransform.Rotator();
+	}
+
+	SetRagdollSnapshot(NewSnapshot);
+}
+
+void AAlsCharacter::ApplyRagdollSnapshot(const float DeltaTime)
+{
+	if (GetLocalRole() == ROLE_SimulatedProxy)
+	{
+		const auto bSuspendPhysics{SignificanceState.ViewerDistance > Settings->Ragdolling.SnapshotPhysicsDistance};
+
+		if (RagdollingState.bPhysicsSuspended != bSuspendPhysics)
+		{
+			StopApplyingRagdollSnapshot();
+
+			RagdollingState.bPhysicsSuspended = bSuspendPhysics;
+			RagdollingState.bReducedSimulation = false;
+
+			GetMesh()->SetAllBodiesBelowSimulatePhysics(UAlsConstants::PelvisBone(), !bSuspendPhysics, true);
+
+			if (Settings->Ragdolling.bUseAsyncPhysicsTick)
+			{
+				RefreshRagdollingAsyncBodies();
+			}
+		}
+	}
+
+	if (RagdollingState.bPhysicsSuspended)
+	{
+		return;
+	}
+
+	// The snapshot bodies are made kinematic and moved through kinematic targets, and the rest of the ragdoll follows them
+	// through the physics constraints. Unlike teleporting simulated bodies, which resets their velocities every frame and
+	// makes the constrained bodies jitter, the solver derives the velocities of the kinematic bodies from their targets.
+	// Non-simulated bodies are normally moved to the animated pose, so this is disabled to keep the kinematic targets, and
+	// the bones of the snapshot bodies are updated from the simulation, just like the bones of the simulated bodies.
+
+	if (!RagdollingState.bSnapshotBodiesKinematic)
+	{
+		RagdollingState.bSnapshotBodiesKinematic = true;
+		GetMesh()->KinematicBonesUpdateType = EKinematicBonesUpdateToPhysics::SkipAllBones;
+	}
+
+	const auto& SnapshotBones{Settings->Ragdolling.SnapshotBones};
+	const auto BlendAmount{UAlsMath::ExponentialDecay(DeltaTime, Settings->Ragdolling.SnapshotBlendSpeed)};
+
+	auto bSimulatedBodiesChanged{false};
+
+	for (auto i{0}; i < FMath::Min(SnapshotBones.Num(), RagdollSnapshot.Bodies.Num()); i++)
+	{
+		auto* Body{GetMesh()->GetBodyInstance(SnapshotBones[i])};
+		if (Body == nullptr)
+		{
+			continue;
+		}
+
+		// The simulation may have been re-enabled for the body, for example, when the reduced simulation was turned off.
+
+		if (Body->IsInstanceSimulatingPhysics())
+		{
+			Body->SetInstanceSimulatePhysics(false, false, true);
+			bSimulatedBodiesChanged = true;
+		}
+
+		Body->bUpdateKinematicFromSimulation = true;
+
+		const auto& SnapshotBody{RagdollSnapshot.Bodies[i]};
+		const auto BodyTransform{Body->GetUnrealWorldTransform()};
+
+		const FTransform NewBodyTransform{
+			FQuat::Slerp(BodyTransform.GetRotation(), SnapshotBody.Rotation.Quaternion(), BlendAmount),
+			FMath::Lerp(BodyTransform.GetLocation(), SnapshotBody.Location, BlendAmount),
+			BodyTransform.GetScale3D()
+		};
+
+		Body->SetBodyTransform(NewBodyTransform, ETeleportType::None);
+	}
+
+	if (bSimulatedBodiesChanged && Settings->Ragdolling.bUseAsyncPhysicsTick)
+	{
+		RefreshRagdollingAsyncBodies();
+	}
+}
+
+void AAlsCharacter::StopApplyingRagdollSnapshot()
+{
+	if (!RagdollingState.bSnapshotBodiesKinematic)
+	{
+		return;
+	}
+
+	RagdollingState.bSnapshotBodiesKinematic = false;
+	GetMesh()->KinematicBonesUpdateType = GetClass()->GetDefaultObject<ThisClass>()->GetMesh()->KinematicBonesUpdateType;
+
+	// Return the snapshot bodies to the physics simulation. The reduced simulation is reapplied on the next refresh.
+
+	for (const auto& BoneName : Settings->Ragdolling.SnapshotBones)
+	{
+		auto* Body{GetMesh()->GetBodyInstance(BoneName)};
+		if (Body != nullptr)
+		{
+			Body->bUpdateKinematicFromSimulation = false;
+			Body->SetInstanceSimulatePhysics(!RagdollingState.bPhysicsSuspended, false, true);
+		}
+	}
+
+	RagdollingState.bReducedSimulation = false;
+
+	if (Settings->Ragdolling.bUseAsyncPhysicsTick)
+	{
+		RefreshRagdollingAsyncBodies();
+	}
+}
+
 void AAlsCharacter::RefreshRagdolling(const float DeltaTime)
 {
-	if (LocomotionAction != AlsLocomotionActionTags::Ragdolling)
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRagdolling)
+
+	if (CompiledState.GetLocomotionAction() != EAlsCompiledLocomotionAction::Ragdolling)
 	{
 		return;
 	}
 
+	INC_DWORD_STAT(STAT_AlsRagdolling_Ragdolls)
+
 	if (RagdollingState.SpeedLimitFrameTimeRemaining > 0)
 	{
 		GetMesh()->ForEachBodyBelow(UAlsConstants::PelvisBone(), true, false, [SpeedLimit = RagdollingState.SpeedLimit](FBodyInstance* Body)
@@ -705,26 +1321,241 @@ void AAlsCharacter::RefreshRagdolling(const float DeltaTime)
 
 	RagdollingState.RootBoneVelocity = GetMesh()->GetPhysicsLinearVelocity(UAlsConstants::RootBone());
 
+	RefreshRagdollingReducedSimulation();
+	RefreshRagdollingSleep(DeltaTime);
+
+	if (RagdollingState.bSleeping)
+	{
+		// Nothing moves while the ragdoll is sleeping, so there is no need to update the motors or the actor transform.
+
+		INC_DWORD_STAT(STAT_AlsRagdolling_Sleeping)
+
+		if (Settings->Ragdolling.bUseAsyncPhysicsTick)
+		{
+			RefreshRagdollingAsyncState(false, NAME_None);
+		}
+
+		return;
+	}
+
+	RefreshRagdollingMotors();
+	RefreshRagdollingActorTransform(DeltaTime);
+}
+
+void AAlsCharacter::RefreshRagdollingAsyncState(const bool bApplyPullForce, const FName& PullForceBoneName)
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRagdollingAsyncState)
+
+	FScopeLock Lock{&RagdollingAsyncStateLock};
+
+	RagdollingAsyncState.bApplyPullForce = bApplyPullForce;
+	RagdollingAsyncState.TargetLocation = RagdollTargetLocation;
+
+	if (RagdollingAsyncState.PullForceBoneName != PullForceBoneName)
+	{
+		RagdollingAsyncState.PullForceBoneName = PullForceBoneName;
+
+		const auto* Body{GetMesh()->GetBodyInstance(PullForceBoneName)};
+		RagdollingAsyncState.PullForceBodyProxy = Body != nullptr ? Body->GetPhysicsActorHandle() : nullptr;
+	}
+
+	RagdollingState.PullForce = RagdollingAsyncState.PullForce;
+}
+
+void AAlsCharacter::RefreshRagdollingAsyncBodies()
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRagdollingAsyncBodies)
+
+	FScopeLock Lock{&RagdollingAsyncStateLock};
+
+	auto& BodyProxies{RagdollingAsyncState.BodyProxies};
+	BodyProxies.Reset();
+
+	GetMesh()->ForEachBodyBelow(UAlsConstants::PelvisBone(), true, false, [&BodyProxies](const FBodyInstance* Body)
+	{
+		if (Body->IsInstanceSimulatingPhysics() && Body->GetPhysicsActorHandle() != nullptr)
+		{
+			BodyProxies.Add(Body->GetPhysicsActorHandle());
+		}
+	});
+}
+
+void AAlsCharacter::RefreshRagdollingPhysicsThread(const float DeltaTime)
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRagdollingPhysicsThread)
+
+	// Runs on the physics thread at a fixed step, so only the physics thread API of the bodies
+	// cached by the game thread can be used here, the skeletal mesh component must not be touched.
+
+	FScopeLock Lock{&RagdollingAsyncStateLock};
+
+	auto& AsyncState{RagdollingAsyncState};
+
+	if (!AsyncState.bActive)
+	{
+		return;
+	}
+
+	if (AsyncState.SpeedLimitFrameTimeRemaining > 0)
+	{
+		for (auto* BodyProxy : AsyncState.BodyProxies)
+		{
+			auto* BodyHandle{AlsRagdolling::GetPhysicsThreadHandle(BodyProxy)};
+			if (BodyHandle != nullptr)
+			{
+				BodyHandle->SetV(BodyHandle->V().GetClampedToMaxSize(AsyncState.SpeedLimit));
+			}
+		}
+
+		AsyncState.SpeedLimitFrameTimeRemaining -= 1;
+	}
+
+	if (!AsyncState.bApplyPullForce)
+	{
+		return;
+	}
+
+	AsyncState.PullForce = FMath::FInterpTo(AsyncState.PullForce, AlsRagdollingConstants::PullForce,
+	                                        DeltaTime, AlsRagdollingConstants::PullForceInterpolationSpeed);
+
+	auto* BodyHandle{AlsRagdolling::GetPhysicsThreadHandle(AsyncState.PullForceBodyProxy)};
+	if (BodyHandle != nullptr)
+	{
+		// Same as an acceleration change on the game thread.
+
+		BodyHandle->AddForce((AsyncState.TargetLocation - BodyHandle->X()) * AsyncState.PullForce * BodyHandle->M());
+	}
+}
+
+void AAlsCharacter::SetRagdollFullSimulationAllowed(const bool bNewAllowed)
+{
+	RagdollingState.bFullSimulationAllowed = bNewAllowed;
+}
+
+void AAlsCharacter::RefreshRagdollingReducedSimulation()
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRagdollingReducedSimulation)
+
+	if (RagdollingState.bPhysicsSuspended)
+	{
+		return;
+	}
+
+	// The ragdoll of a locally controlled player is always fully simulated.
+
+	const auto bReduceSimulation{
+		(!IsLocallyControlled() || !IsPlayerControlled()) &&
+		(!RagdollingState.bFullSimulationAllowed ||
+		 (Settings->Ragdolling.ReducedSimulationDistance > 0.0f &&
+		  SignificanceState.ViewerDistance > Settings->Ragdolling.ReducedSimulationDistance))
+	};
+
+	if (RagdollingState.bReducedSimulation != bReduceSimulation)
+	{
+		RagdollingState.bReducedSimulation = bReduceSimulation;
+
+		for (const auto& BoneName : Settings->Ragdolling.ReducedSimulationBones)
+		{
+			GetMesh()->SetAllBodiesBelowSimulatePhysics(BoneName, !bReduceSimulation, true);
+		}
+
+		if (Settings->Ragdolling.bUseAsyncPhysicsTick)
+		{
+			RefreshRagdollingAsyncBodies();
+		}
+	}
+
+	if (RagdollingState.bReducedSimulation)
+	{
+		INC_DWORD_STAT(STAT_AlsRagdolling_ReducedSimulation)
+	}
+}
+
+void AAlsCharacter::RefreshRagdollingSleep(const float DeltaTime)
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRagdollingSleep)
+
+	if (RagdollingState.bSleeping)
+	{
+		// Wake up if something has hit the ragdoll, or if the replicated target location has moved away from it.
+
+		static constexpr auto WakeUpDistance{10.0f};
+
+		if (GetMesh()->IsAnyRigidBodyAwake() ||
+		    (!IsLocallyControlled() && FVector::DistSquared(RagdollTargetLocation,
+		                                                    GetMesh()->GetSocketLocation(UAlsConstants::PelvisBone())) >
+		     FMath::Square(WakeUpDistance)))
+		{
+			RagdollingState.bSleeping = false;
+			RagdollingState.SettledTime = 0.0f;
+
+			GetMesh()->WakeAllRigidBodies();
+		}
+
+		return;
+	}
+
+	if (Settings->Ragdolling.SleepDelay <= 0.0f || RagdollingState.bPhysicsSuspended || !RagdollingState.bGrounded ||
+	    RagdollingState.RootBoneVelocity.SizeSquared() > FMath::Square(Settings->Ragdolling.SleepSpeedThreshold))
+	{
+		RagdollingState.SettledTime = 0.0f;
+		return;
+	}
+
+	RagdollingState.SettledTime += DeltaTime;
+
+	if (RagdollingState.SettledTime >= Settings->Ragdolling.SleepDelay)
+	{
+		RagdollingState.bSleeping = true;
+
+		GetMesh()->PutAllRigidBodiesToSleep();
+	}
+}
+
+void AAlsCharacter::RefreshRagdollingMotors()
+{
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRagdollingMotors)
+
 	// Use the velocity to scale ragdoll joint strength for physical animation.
 
 	static constexpr auto ReferenceSpeed{1000.0f};
-	static constexpr auto Stiffness{25000.0f};
+	static constexpr auto MaxStiffness{25000.0f};
 
-	GetMesh()->SetAllMotorsAngularDriveParams(UAlsMath::Clamp01(UE_REAL_TO_FLOAT(
-		                                          RagdollingState.RootBoneVelocity.Size()) / ReferenceSpeed) * Stiffness,
-	                                          0.0f, 0.0f, false);
+	const auto Stiffness{UAlsMath::Clamp01(UE_REAL_TO_FLOAT(RagdollingState.RootBoneVelocity.Size()) / ReferenceSpeed) * MaxStiffness};
 
-	RefreshRagdollingActorTransform(DeltaTime);
+	// Small changes are skipped, but the limits are always applied exactly.
+
+	const auto bLimitReached{Stiffness <= 0.0f || Stiffness >= MaxStiffness};
+
+	if (RagdollingState.MotorStiffness >= 0.0f &&
+	    (Stiffness == RagdollingState.MotorStiffness ||
+	     (!bLimitReached && FMath::Abs(Stiffness - RagdollingState.MotorStiffness) < Settings->Ragdolling.MotorStiffnessUpdateThreshold)))
+	{
+		return;
+	}
+
+	RagdollingState.MotorStiffness = Stiffness;
+
+	GetMesh()->SetAllMotorsAngularDriveParams(Stiffness, 0.0f, 0.0f, false);
+
+	INC_DWORD_STAT(STAT_AlsRagdolling_MotorUpdates)
 }
 
 void AAlsCharacter::RefreshRagdollingActorTransform(const float DeltaTime)
 {
+	ALS_TRACE_SCOPE(AAlsCharacter_RefreshRagdollingActorTransform)
+
 	const auto bLocallyControlled{IsLocallyControlled()};
 	const auto PelvisTransform{GetMesh()->GetSocketTransform(UAlsConstants::PelvisBone())};
 
 	if (bLocallyControlled)
 	{
 		SetRagdollTargetLocation(PelvisTransform.GetLocation());
+
+		if (Settings->Ragdolling.bEnableSnapshotReplication)
+		{
+			CaptureRagdollSnapshot(DeltaTime);
+		}
 	}
 
 	// Trace downward from the target location to offset the target location, preventing the lower
@@ -736,42 +1567,78 @@ void AAlsCharacter::RefreshRagdollingActorTransform(const float DeltaTime)
 		ObjectQueryParameters.AddObjectTypesToQuery(UCollisionProfile::Get()->ConvertToCollisionChannel(false, ObjectType));
 	}
 
-	FHitResult Hit;
-	GetWorld()->LineTraceSingleByObjectType(Hit, RagdollTargetLocation, {
-		                                        RagdollTargetLocation.X,
-		                                        RagdollTargetLocation.Y,
-		                                        RagdollTargetLocation.Z - GetCapsuleComponent()->GetScaledCapsuleHalfHeight()
-	                                        }, ObjectQueryParameters, {ANSI_TO_TCHAR(__FUNCTION__), false, this});
+	// If the ground trace is deferred, the ground distance from the last trace is used instead.
 
-	auto NewActorLocation{RagdollTargetLocation};
+	if (UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(GetWorld(), EAlsPhysicsQueryCategory::Ragdolling,
+	                                                      SignificanceState.Significance, RagdollingState.GroundDistance >= 0.0f))
+	{
+		FHitResult Hit;
+		GetWorld()->LineTraceSingleByObjectType(Hit, RagdollTargetLocation, {
+			                                        RagdollTargetLocation.X,
+			                                        RagdollTargetLocation.Y,
+			                                        RagdollTargetLocation.Z - GetCapsuleComponent()->GetScaledCapsuleHalfHeight()
+		                                        }, ObjectQueryParameters, {ANSI_TO_TCHAR(__FUNCTION__), false, this});
+
+		RagdollingState.bGrounded = Hit.IsValidBlockingHit();
+		RagdollingState.GroundDistance = RagdollingState.bGrounded
+			                                 ? UE_REAL_TO_FLOAT(FMath::Abs(Hit.ImpactPoint.Z - Hit.TraceStart.Z))
+			                                 : 0.0f;
+	}
 
-	RagdollingState.bGrounded = Hit.IsValidBlockingHit();
+	auto NewActorLocation{RagdollTargetLocation};
 
 	if (RagdollingState.bGrounded)
 	{
-		NewActorLocation.Z += GetCapsuleComponent()->GetScaledCapsuleHalfHeight() - FMath::Abs(Hit.ImpactPoint.Z - Hit.TraceStart.Z) + 1.0f;
+		NewActorLocation.Z += GetCapsuleComponent()->GetScaledCapsuleHalfHeight() - RagdollingState.GroundDistance + 1.0f;
 	}
 
-	if (!bLocallyControlled)
-	{
-		static constexpr auto PullForce{750.0f};
-		static constexpr auto InterpolationSpeed{0.6f};
+	auto bApplyPullForce{false};
+	FName PullForceSocketName;
 
-		RagdollingState.PullForce = FMath::FInterpTo(RagdollingState.PullForce, PullForce, DeltaTime, InterpolationSpeed);
+	if (!bLocallyControlled && Settings->Ragdolling.bEnableSnapshotReplication && RagdollSnapshot.Bodies.Num() > 0)
+	{
+		ApplyRagdollSnapshot(DeltaTime);
+	}
+	else if (!bLocallyControlled)
+	{
+		StopApplyingRagdollSnapshot();
 
 		const auto RootBoneHorizontalSpeedSquared{RagdollingState.RootBoneVelocity.SizeSquared2D()};
 
-		const auto PullForceSocketName{
-			RootBoneHorizontalSpeedSquared > FMath::Square(300.0f) ? UAlsConstants::Spine03Bone() : UAlsConstants::PelvisBone()
-		};
+		bApplyPullForce = true;
+		PullForceSocketName = RootBoneHorizontalSpeedSquared > FMath::Square(300.0f)
+			                      ? UAlsConstants::Spine03Bone()
+			                      : UAlsConstants::PelvisBone();
+
+		if (!Settings->Ragdolling.bUseAsyncPhysicsTick)
+		{
+			RagdollingState.PullForce = FMath::FInterpTo(RagdollingState.PullForce, AlsRagdollingConstants::PullForce,
+			                                             DeltaTime, AlsRagdollingConstants::PullForceInterpolationSpeed);
+
+			GetMesh()->AddForce((RagdollTargetLocation - GetMesh()->GetSocketLocation(PullForceSocketName)) * RagdollingState.PullForce,
+			                    PullForceSocketName, true);
+		}
+	}
 
-		GetMesh()->AddForce((RagdollTargetLocation - GetMesh()->GetSocketLocation(PullForceSocketName)) * RagdollingState.PullForce,
-		                    PullForceSocketName, true);
+	if (Settings->Ragdolling.bUseAsyncPhysicsTick)
+	{
+		RefreshRagdollingAsyncState(bApplyPullForce, PullForceSocketName);
 	}
 
 	// Determine whether the ragdoll is facing upward or downward and set the target rotation accordingly.
 
-	const auto PelvisRotation{PelvisTransform.Rotator()};
+	auto PelvisRotation{PelvisTransform.Rotator()};
+
+	if (RagdollingState.bPhysicsSuspended)
+	{
+		// The animated pelvis follows the actor rotation, so take the pelvis rotation from the snapshot to avoid a feedback loop.
+
+		const auto PelvisIndex{Settings->Ragdolling.SnapshotBones.IndexOfByKey(UAlsConstants::PelvisBone())};
+
+		PelvisRotation = RagdollSnapshot.Bodies.IsValidIndex(PelvisIndex)
+			                 ? RagdollSnapshot.Bodies[PelvisIndex].Rotation
+			                 : GetActorRotation();
+	}
 
 	RagdollingState.bFacedUpward = PelvisRotation.Roll <= 0.0f;
 
@@ -783,7 +1650,7 @@ void AAlsCharacter::RefreshRagdollingActorTransform(const float DeltaTime)
 
 bool AAlsCharacter::IsRagdollingAllowedToStop() const
 {
-	return LocomotionAction == AlsLocomotionActionTags::Ragdolling;
+	return CompiledState.GetLocomotionAction() == EAlsCompiledLocomotionAction::Ragdolling;
 }
 
 bool AAlsCharacter::TryStopRagdolling()
@@ -795,10 +1662,14 @@ bool AAlsCharacter::TryStopRagdolling()
 
 	if (GetLocalRole() >= ROLE_Authority)
 	{
-		MulticastStopRagdolling();
+		FAlsActionEvent Event;
+		Event.Type = EAlsActionEventType::StopRagdolling;
+
+		AddActionEvent(Event);
 	}
 	else
 	{
+		ALS_TRACE_COUNTER_ADD(ServerStopRagdollingCalls, 1);
 		ServerStopRagdolling();
 	}
 
@@ -809,14 +1680,11 @@ void AAlsCharacter::ServerStopRagdolling_Implementation()
 {
 	if (IsRagdollingAllowedToStop())
 	{
-		MulticastStopRagdolling();
-		ForceNetUpdate();
-	}
-}
+		FAlsActionEvent Event;
+		Event.Type = EAlsActionEventType::StopRagdolling;
 
-void AAlsCharacter::MulticastStopRagdolling_Implementation()
-{
-	StopRagdollingImplementation();
+		AddActionEvent(Event);
+	}
 }
 
 void AAlsCharacter::StopRagdollingImplementation()
@@ -830,6 +1698,18 @@ void AAlsCharacter::StopRagdollingImplementation()
 
 	RagdollingState.bPendingFinalization = true;
 
+	{
+		FScopeLock Lock{&RagdollingAsyncStateLock};
+
+		RagdollingAsyncState.bActive = false;
+		RagdollingAsyncState.BodyProxies.Reset();
+		RagdollingAsyncState.PullForceBodyProxy = nullptr;
+	}
+
+	// Restore the animation tick option that may have been changed on the dedicated server while ragdolling.
+
+	RefreshVisibilityBasedAnimTickOption();
+
 	SetLocomotionAction(FGameplayTag::EmptyTag);
 
 	OnRagdollingEnded();
@@ -851,6 +1731,8 @@ void AAlsCharacter::FinalizeRagdolling()
 
 	RagdollingState.bPendingFinalization = false;
 
+	StopApplyingRagdollSnapshot();
+
 	// Disable physics simulation of a mesh and enable capsule collision.
 
 	GetMesh()->SetAllBodiesSimulatePhysics(false);
@@ -0,0 +1,121 @@
+#include "AlsLedgeIndex.h"
+
+#include "AlsLedgeIndexSubsystem.h"
+#include "Engine/World.h"
+
+AAlsLedgeIndex::AAlsLedgeIndex()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	SetCanBeDamaged(false);
+}
+
+void AAlsLedgeIndex::BeginPlay()
+{
+	Super::BeginPlay();
+
+	auto* LedgeIndexSubsystem{GetWorld()->GetSubsystem<UAlsLedgeIndexSubsystem>()};
+	if (IsValid(LedgeIndexSubsystem))
+	{
+		LedgeIndexSubsystem->RegisterLedgeIndex(this);
+	}
+}
+
+void AAlsLedgeIndex::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	auto* LedgeIndexSubsystem{GetWorld()->GetSubsystem<UAlsLedgeIndexSubsystem>()};
+	if (IsValid(LedgeIndexSubsystem))
+	{
+		LedgeIndexSubsystem->UnregisterLedgeIndex(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAlsLedgeIndex::Build(const FBox& NewBounds, const TArray<FAlsLedge>& NewLedges, const float NewCellSize)
+{
+	CellSize = FMath::Max(1.0f, NewCellSize);
+	Bounds = NewBounds;
+	Ledges = NewLedges;
+
+	Cells.Reset();
+
+	// Ledges are expected to be shorter than a cell, so it's enough to add them to the cells of their start, middle and end.
+
+	for (auto i{0}; i < Ledges.Num(); i++)
+	{
+		const auto& Ledge{Ledges[i]};
+
+		Cells.FindOrAdd(CalculateCell(Ledge.Start)).LedgeIndices.AddUnique(i);
+		Cells.FindOrAdd(CalculateCell((Ledge.Start + Ledge.End) * 0.5f)).LedgeIndices.AddUnique(i);
+		Cells.FindOrAdd(CalculateCell(Ledge.End)).LedgeIndices.AddUnique(i);
+	}
+
+	Cells.Compact();
+}
+
+const FAlsLedge* AAlsLedgeIndex::FindMantlingLedge(const FVector& Location, const FVector& Direction, const float ReachDistance,
+                                                   const FFloatInterval& HeightRange, const float MaxAngle,
+                                                   FVector& LedgeLocation) const
+{
+	const auto MinCell{CalculateCell({Location.X - ReachDistance, Location.Y - ReachDistance, Location.Z + HeightRange.Min})};
+	const auto MaxCell{CalculateCell({Location.X + ReachDistance, Location.Y + ReachDistance, Location.Z + HeightRange.Max})};
+
+	const auto MinDirectionDot{FMath::Cos(FMath::DegreesToRadians(MaxAngle))};
+
+	const FAlsLedge* ClosestLedge{nullptr};
+	auto ClosestDistanceSquared{FMath::Square(ReachDistance)};
+
+	for (auto X{MinCell.X}; X <= MaxCell.X; X++)
+	{
+		for (auto Y{MinCell.Y}; Y <= MaxCell.Y; Y++)
+		{
+			for (auto Z{MinCell.Z}; Z <= MaxCell.Z; Z++)
+			{
+				const auto* Cell{Cells.Find({X, Y, Z})};
+				if (Cell == nullptr)
+				{
+					continue;
+				}
+
+				// A ledge may be visited more than once if it's in several cells, but the result is the same.
+
+				for (const auto LedgeIndex : Cell->LedgeIndices)
+				{
+					const auto& Ledge{Ledges[LedgeIndex]};
+
+					if (-(Ledge.Normal | Direction) < MinDirectionDot)
+					{
+						continue;
+					}
+
+					const auto ClosestPoint{
+						FMath::ClosestPointOnSegment({Location.X, Location.Y, Ledge.Start.Z}, Ledge.Start, Ledge.End)
+					};
+
+					const auto Height{ClosestPoint.Z - Location.Z};
+					if (!HeightRange.Contains(Height))
+					{
+						continue;
+					}
+
+					const auto Offset{ClosestPoint - Location};
+					if ((Offset | Direction) <= 0.0f)
+					{
+						continue;
+					}
+
+					const auto DistanceSquared{Offset.SizeSquared2D()};
+					if (DistanceSquared < ClosestDistanceSquared)
+					{
+						ClosestDistanceSquared = DistanceSquared;
+						ClosestLedge = &Ledge;
+						LedgeLocation = ClosestPoint;
+					}
+				}
+			}
+		}
+	}
+
+	return ClosestLedge;
+}
@@ -0,0 +1,68 @@
+#include "AlsLedgeIndexSubsystem.h"
+
+#include "AlsLedgeIndex.h"
+
+bool UAlsLedgeIndexSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsLedgeIndexSubsystem::RegisterLedgeIndex(AAlsLedgeIndex* LedgeIndex)
+{
+	if (IsValid(LedgeIndex))
+	{
+		LedgeIndices.AddUnique(LedgeIndex);
+	}
+}
+
+void UAlsLedgeIndexSubsystem::UnregisterLedgeIndex(AAlsLedgeIndex* LedgeIndex)
+{
+	LedgeIndices.RemoveSingleSwap(LedgeIndex);
+}
+
+bool UAlsLedgeIndexSubsystem::IsLocationCovered(const FVector& Location) const
+{
+	for (const auto* LedgeIndex : LedgeIndices)
+	{
+		if (IsValid(LedgeIndex) && LedgeIndex->IsLocationCovered(Location))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+const FAlsLedge* UAlsLedgeIndexSubsystem::FindMantlingLedge(const FVector& Location, const FVector& Direction, const float ReachDistance,
+                                                            const FFloatInterval& HeightRange, const float MaxAngle,
+                                                            FVector& LedgeLocation) const
+{
+	const FAlsLedge* ClosestLedge{nullptr};
+	auto ClosestDistanceSquared{FMath::Square(ReachDistance)};
+
+	for (const auto* LedgeIndex : LedgeIndices)
+	{
+		if (!IsValid(LedgeIndex))
+		{
+			continue;
+		}
+
+		FVector IndexLedgeLocation;
+		const auto* Ledge{LedgeIndex->FindMantlingLedge(Location, Direction, ReachDistance, HeightRange, MaxAngle, IndexLedgeLocation)};
+
+		if (Ledge == nullptr)
+		{
+			continue;
+		}
+
+		const auto DistanceSquared{(IndexLedgeLocation - Location).SizeSquared2D()};
+		if (DistanceSquared < ClosestDistanceSquared)
+		{
+			ClosestDistanceSquared = DistanceSquared;
+			ClosestLedge = Ledge;
+			LedgeLocation = IndexLedgeLocation;
+		}
+	}
+
+	return ClosestLedge;
+}
@@ -0,0 +1,283 @@
+#include "AlsLocomotionBatchSubsystem.h"
+
+#include "AlsCharacter.h"
+#include "AlsAnimationInstance.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Settings/AlsCharacterSettings.h"
+#include "Utility/AlsTrace.h"
+#include "Utility/AlsUtility.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Characters"), STAT_AlsLocomotionBatch_Characters, STATGROUP_Als)
+
+namespace AlsLocomotionBatchSubsystemConstants
+{
+	// Number of characters processed by a single worker task.
+	static constexpr auto ChunkSize{16};
+}
+
+void FAlsLocomotionBatchTickFunction::ExecuteTick(const float DeltaTime, const ELevelTick TickType, ENamedThreads::Type CurrentThread,
+                                                  const FGraphEventRef& CompletionGraphEvent)
+{
+	if (IsValid(Subsystem) && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Subsystem->Tick(DeltaTime);
+	}
+}
+
+FString FAlsLocomotionBatchTickFunction::DiagnosticMessage()
+{
+	return TEXT("FAlsLocomotionBatchTickFunction");
+}
+
+void FAlsViewBatch::SetNum(const int32 Num)
+{
+	DeltaTimes.SetNumUninitialized(Num, false);
+	NetworkSmoothingEnabled.SetNumUninitialized(Num, false);
+	NetworkSmoothingServerTimes.SetNumUninitialized(Num, false);
+	NetworkSmoothingClientTimes.SetNumUninitialized(Num, false);
+	NetworkSmoothingDurations.SetNumUninitialized(Num, false);
+	NetworkSmoothingInitialRotations.SetNumUninitialized(Num, false);
+	NetworkSmoothingRotations.SetNumUninitialized(Num, false);
+	NetworkSmoothingBuffers.SetNumUninitialized(Num, false);
+	NetworkSmoothingMaxExtrapolationTimes.SetNumUninitialized(Num, false);
+	RawViewRotations.SetNumUninitialized(Num, false);
+	PreviousYawAngles.SetNumUninitialized(Num, false);
+	YawSpeeds.SetNumUninitialized(Num, false);
+}
+
+void FAlsLocomotionBatch::SetNum(const int32 Num)
+{
+	DeltaTimes.SetNumUninitialized(Num, false);
+	MovingSpeedThresholds.SetNumUninitialized(Num, false);
+	InputDirections.SetNumUninitialized(Num, false);
+	Velocities.SetNumUninitialized(Num, false);
+	PreviousVelocities.SetNumUninitialized(Num, false);
+	HasInput.SetNumUninitialized(Num, false);
+	InputYawAngles.SetNumUninitialized(Num, false);
+	HasSpeed.SetNumUninitialized(Num, false);
+	Speeds.SetNumUninitialized(Num, false);
+	VelocityYawAngles.SetNumUninitialized(Num, false);
+	Accelerations.SetNumUninitialized(Num, false);
+	Moving.SetNumUninitialized(Num, false);
+}
+
+void UAlsLocomotionBatchSubsystem::Deinitialize()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+
+	Characters.Reset();
+	BatchedCharacters.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UAlsLocomotionBatchSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsLocomotionBatchSubsystem::RegisterCharacter(AAlsCharacter* Character)
+{
+	if (!IsValid(Character) || !IsValid(Character->GetCharacterMovement()) || Characters.Contains(Character))
+	{
+		return;
+	}
+
+	if (!TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.Subsystem = this;
+		TickFunction.TickGroup = TG_PrePhysics;
+		TickFunction.bCanEverTick = true;
+		TickFunction.bStartWithTickEnabled = true;
+
+		TickFunction.RegisterTickFunction(GetWorld()->PersistentLevel);
+	}
+
+	Characters.Add(Character);
+
+	// The batch must run after the character movement component has moved the character (so the velocity and the actor
+	// transform are up to date for this frame), but before the character tick that consumes the refreshed state.
+
+	auto* CharacterMovement{Character->GetCharacterMovement()};
+
+	TickFunction.AddPrerequisite(CharacterMovement, CharacterMovement->PrimaryComponentTick);
+	Character->PrimaryActorTick.AddPrerequisite(this, TickFunction);
+}
+
+void UAlsLocomotionBatchSubsystem::UnregisterCharacter(AAlsCharacter* Character)
+{
+	if (Characters.RemoveSingleSwap(Character) <= 0 || !IsValid(Character))
+	{
+		return;
+	}
+
+	auto* CharacterMovement{Character->GetCharacterMovement()};
+	if (IsValid(CharacterMovement))
+	{
+		TickFunction.RemovePrerequisite(CharacterMovement, CharacterMovement->PrimaryComponentTick);
+	}
+
+	Character->PrimaryActorTick.RemovePrerequisite(this, TickFunction);
+}
+
+void UAlsLocomotionBatchSubsystem::Tick(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsLocomotionBatchSubsystem::Tick()"), STAT_UAlsLocomotionBatchSubsystem_Tick, STATGROUP_Als)
+
+	GatherInputs(DeltaTime);
+
+	const auto CharactersCount{BatchedCharacters.Num()};
+
+	SET_DWORD_STAT(STAT_AlsLocomotionBatch_Characters, CharactersCount);
+
+	if (CharactersCount <= 0)
+	{
+		return;
+	}
+
+	const auto ChunksCount{FMath::DivideAndRoundUp(CharactersCount, AlsLocomotionBatchSubsystemConstants::ChunkSize)};
+
+	ParallelFor(ChunksCount, [this, CharactersCount](const int32 ChunkIndex)
+	{
+		const auto StartIndex{ChunkIndex * AlsLocomotionBatchSubsystemConstants::ChunkSize};
+		const auto EndIndex{FMath::Min(StartIndex + AlsLocomotionBatchSubsystemConstants::ChunkSize, CharactersCount)};
+
+		RefreshViewBatch(ViewBatch, StartIndex, EndIndex);
+		RefreshLocomotionBatch(LocomotionBatch, StartIndex, EndIndex);
+	}, ChunksCount <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	WriteOutputs();
+}
+
+void UAlsLocomotionBatchSubsystem::GatherInputs(const float DeltaTime)
+{
+	BatchedCharacters.Reset();
+
+	for (auto* Character : Characters)
+	{
+		// Only characters that will be fully updated in this frame by their own tick are refreshed.
+
+		if (IsValid(Character) && IsValid(Character->Settings) && Character->AnimationInstance.IsValid() &&
+		    Character->PrimaryActorTick.IsTickFunctionEnabled() && Character->PrimaryActorTick.TickInterval <= 0.0f &&
+		    Character->ShouldRefreshFullTick(Character->SignificanceState.PendingDeltaTime + DeltaTime * Character->CustomTimeDilation))
+		{
+			BatchedCharacters.Add(Character);
+		}
+	}
+
+	ViewBatch.SetNum(BatchedCharacters.Num());
+	LocomotionBatch.SetNum(BatchedCharacters.Num());
+
+	for (auto Index{0}; Index < BatchedCharacters.Num(); Index++)
+	{
+		auto* Character{BatchedCharacters[Index]};
+
+		const auto CharacterDeltaTime{Character->SignificanceState.PendingDeltaTime + DeltaTime * Character->CustomTimeDilation};
+
+		// Same as the beginning of AAlsCharacter::RefreshFullTick(), but without the thread safe part.
+
+		Character->ViewState.Rotation = Character->SignificanceState.ViewRotation;
+
+		Character->RefreshLocomotionLocationAndRotation(CharacterDeltaTime);
+
+		Character->PrepareViewRefresh();
+		Character->PrepareLocomotionRefresh();
+
+		const auto& NetworkSmoothing{Character->ViewState.NetworkSmoothing};
+
+		ViewBatch.DeltaTimes[Index] = CharacterDeltaTime;
+		ViewBatch.NetworkSmoothingEnabled[Index] = NetworkSmoothing.bEnabled && Character->Settings->Significance
+		                                           .GetBucketSettings(Character->SignificanceState.Significance).bAllowViewNetworkSmoothing;
+		ViewBatch.NetworkSmoothingServerTimes[Index] = NetworkSmoothing.ServerTime;
+		ViewBatch.NetworkSmoothingClientTimes[Index] = NetworkSmoothing.ClientTime;
+		ViewBatch.NetworkSmoothingDurations[Index] = NetworkSmoothing.Duration;
+		ViewBatch.NetworkSmoothingInitialRotations[Index] = NetworkSmoothing.InitialRotation;
+		ViewBatch.NetworkSmoothingRotations[Index] = NetworkSmoothing.Rotation;
+		ViewBatch.NetworkSmoothingBuffers[Index] = nullptr;
+
+		if (Character->Settings->View.bEnableNetworkSmoothingBuffer && NetworkSmoothing.Buffer.SamplesCount > 0)
+		{
+			ViewBatch.NetworkSmoothingBuffers[Index] = &NetworkSmoothing.Buffer;
+		}
+
+		ViewBatch.NetworkSmoothingMaxExtrapolationTimes[Index] = Character->Settings->View.NetworkSmoothingMaxExtrapolationTime;
+		ViewBatch.RawViewRotations[Index] = Character->RawViewRotation;
+		ViewBatch.PreviousYawAngles[Index] = Character->ViewState.PreviousYawAngle;
+
+		const auto& LocomotionState{Character->LocomotionState};
+
+		LocomotionBatch.DeltaTimes[Index] = CharacterDeltaTime;
+		LocomotionBatch.MovingSpeedThresholds[Index] = Character->Settings->MovingSpeedThreshold;
+		LocomotionBatch.InputDirections[Index] = Character->InputDirection;
+		LocomotionBatch.Velocities[Index] = LocomotionState.Velocity;
+		LocomotionBatch.PreviousVelocities[Index] = LocomotionState.PreviousVelocity;
+		LocomotionBatch.InputYawAngles[Index] = LocomotionState.InputYawAngle;
+		LocomotionBatch.VelocityYawAngles[Index] = LocomotionState.VelocityYawAngle;
+	}
+}
+
+void UAlsLocomotionBatchSubsystem::WriteOutputs()
+{
+	for (auto Index{0}; Index < BatchedCharacters.Num(); Index++)
+	{
+		auto* Character{BatchedCharacters[Index]};
+
+		auto& ViewState{Character->ViewState};
+
+		ViewState.NetworkSmoothing.ClientTime = ViewBatch.NetworkSmoothingClientTimes[Index];
+		ViewState.NetworkSmoothing.InitialRotation = ViewBatch.NetworkSmoothingInitialRotations[Index];
+		ViewState.NetworkSmoothing.Rotation = ViewBatch.NetworkSmoothingRotations[Index];
+
+		ViewState.Rotation = ViewState.NetworkSmoothing.Rotation;
+		ViewState.YawSpeed = ViewBatch.YawSpeeds[Index];
+
+		auto& LocomotionState{Character->LocomotionState};
+
+		LocomotionState.bHasInput = LocomotionBatch.HasInput[Index];
+		LocomotionState.InputYawAngle = LocomotionBatch.InputYawAngles[Index];
+		LocomotionState.bHasSpeed = LocomotionBatch.HasSpeed[Index];
+		LocomotionState.Speed = LocomotionBatch.Speeds[Index];
+		LocomotionState.VelocityYawAngle = LocomotionBatch.VelocityYawAngles[Index];
+		LocomotionState.Acceleration = LocomotionBatch.Accelerations[Index];
+		LocomotionState.bMoving = LocomotionBatch.Moving[Index];
+
+		Character->BatchedRefreshFrameNumber = GFrameCounter;
+	}
+}
+
+void UAlsLocomotionBatchSubsystem::RefreshViewBatch(FAlsViewBatch& Batch, const int32 StartIndex, const int32 EndIndex)
+{
+	ALS_TRACE_SCOPE(UAlsLocomotionBatchSubsystem_RefreshViewBatch)
+
+	for (auto Index{StartIndex}; Index < EndIndex; Index++)
+	{
+		AAlsCharacter::RefreshViewNetworkSmoothingRotation(Batch.NetworkSmoothingEnabled[Index], Batch.NetworkSmoothingBuffers[Index],
+		                                                   Batch.NetworkSmoothingMaxExtrapolationTimes[Index],
+		                                                   Batch.NetworkSmoothingServerTimes[Index], Batch.NetworkSmoothingDurations[Index],
+		                                                   Batch.RawViewRotations[Index], Batch.DeltaTimes[Index],
+		                                                   Batch.NetworkSmoothingClientTimes[Index],
+		                                                   Batch.NetworkSmoothingInitialRotations[Index],
+		                                                   Batch.NetworkSmoothingRotations[Index]);
+
+		Batch.YawSpeeds[Index] = AAlsCharacter::CalculateViewYawSpeed(Batch.NetworkSmoothingRotations[Index],
+		                                                              Batch.PreviousYawAngles[Index], Batch.DeltaTimes[Index]);
+	}
+}
+
+void UAlsLocomotionBatchSubsystem::RefreshLocomotionBatch(FAlsLocomotionBatch& Batch, const int32 StartIndex, const int32 EndIndex)
+{
+	ALS_TRACE_SCOPE(UAlsLocomotionBatchSubsystem_RefreshLocomotionBatch)
+
+	for (auto Index{StartIndex}; Index < EndIndex; Index++)
+	{
+		AAlsCharacter::RefreshLocomotionMovement(Batch.InputDirections[Index], Batch.Velocities[Index], Batch.PreviousVelocities[Index],
+		                                         Batch.MovingSpeedThresholds[Index], Batch.DeltaTimes[Index], Batch.HasInput[Index],
+		                                         Batch.InputYawAngles[Index], Batch.HasSpeed[Index], Batch.Speeds[Index],
+		                                         Batch.VelocityYawAngles[Index], Batch.Accelerations[Index], Batch.Moving[Index]);
+	}
+}
@@ -0,0 +1,204 @@
+#include "AlsPhysicsQuerySubsystem.h"
+
+#include "Engine/World.h"
+#include "Utility/AlsTrace.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Physics Queries"), STAT_AlsPhysicsQueries, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Physics Queries"), STAT_AlsPhysicsQueries_Deferred, STATGROUP_Als)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Foot Ik Physics Queries"), STAT_AlsPhysicsQueries_FootIk, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ground Prediction Physics Queries"), STAT_AlsPhysicsQueries_GroundPrediction, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mantling Physics Queries"), STAT_AlsPhysicsQueries_Mantling, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ragdolling Physics Queries"), STAT_AlsPhysicsQueries_Ragdolling, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Physics Queries"), STAT_AlsPhysicsQueries_Camera, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Footsteps Physics Queries"), STAT_AlsPhysicsQueries_Footsteps, STATGROUP_Als)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Foot Ik Physics Queries"), STAT_AlsPhysicsQueries_FootIkDeferred, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Ground Prediction Physics Queries"), STAT_AlsPhysicsQueries_GroundPredictionDeferred,
+                           STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Mantling Physics Queries"), STAT_AlsPhysicsQueries_MantlingDeferred, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Ragdolling Physics Queries"), STAT_AlsPhysicsQueries_RagdollingDeferred, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Camera Physics Queries"), STAT_AlsPhysicsQueries_CameraDeferred, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Footsteps Physics Queries"), STAT_AlsPhysicsQueries_FootstepsDeferred, STATGROUP_Als)
+
+namespace AlsPhysicsQuery
+{
+#if ALS_TRACE_ENABLED
+	static void TraceQueries(const EAlsPhysicsQueryCategory Category, const bool bDeferred, const int32 QueriesCount)
+	{
+		// The trace counters are not atomic, so the values of the categories queried from the worker
+		// threads are approximate in the Unreal Insights counters view, but exact in the CSV profiler.
+
+		switch (Category)
+		{
+			case EAlsPhysicsQueryCategory::FootIk:
+				if (bDeferred)
+				{
+					ALS_TRACE_COUNTER_ADD(FootIkQueriesDeferred, QueriesCount);
+				}
+				else
+				{
+					ALS_TRACE_COUNTER_ADD(FootIkQueries, QueriesCount);
+				}
+				break;
+
+			case EAlsPhysicsQueryCategory::GroundPrediction:
+				if (bDeferred)
+				{
+					ALS_TRACE_COUNTER_ADD(GroundPredictionQueriesDeferred, QueriesCount);
+				}
+				else
+				{
+					ALS_TRACE_COUNTER_ADD(GroundPredictionQueries, QueriesCount);
+				}
+				break;
+
+			case EAlsPhysicsQueryCategory::Mantling:
+				if (bDeferred)
+				{
+					ALS_TRACE_COUNTER_ADD(MantlingQueriesDeferred, QueriesCount);
+				}
+				else
+				{
+					ALS_TRACE_COUNTER_ADD(MantlingQueries, QueriesCount);
+				}
+				break;
+
+			case EAlsPhysicsQueryCategory::Ragdolling:
+				if (bDeferred)
+				{
+					ALS_TRACE_COUNTER_ADD(RagdollingQueriesDeferred, QueriesCount);
+				}
+				else
+				{
+					ALS_TRACE_COUNTER_ADD(RagdollingQueries, QueriesCount);
+				}
+				break;
+
+			case EAlsPhysicsQueryCategory::Camera:
+				if (bDeferred)
+				{
+					ALS_TRACE_COUNTER_ADD(CameraQueriesDeferred, QueriesCount);
+				}
+				else
+				{
+					ALS_TRACE_COUNTER_ADD(CameraQueries, QueriesCount);
+				}
+				break;
+
+			case EAlsPhysicsQueryCategory::Footsteps:
+				if (bDeferred)
+				{
+					ALS_TRACE_COUNTER_ADD(FootstepsQueriesDeferred, QueriesCount);
+				}
+				else
+				{
+					ALS_TRACE_COUNTER_ADD(FootstepsQueries, QueriesCount);
+				}
+				break;
+		}
+	}
+#endif
+}
+
+bool UAlsPhysicsQuerySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UAlsPhysicsQuerySubsystem::TryAcquireQueries(const EAlsPhysicsQueryCategory Category, const EAlsSignificance Significance,
+                                                  const bool bAllowDeferral, const int32 QueriesCount)
+{
+#if STATS
+	static const FName CategoryQueriesStats[]
+	{
+		GET_STATFNAME(STAT_AlsPhysicsQueries_FootIk),
+		GET_STATFNAME(STAT_AlsPhysicsQueries_GroundPrediction),
+		GET_STATFNAME(STAT_AlsPhysicsQueries_Mantling),
+		GET_STATFNAME(STAT_AlsPhysicsQueries_Ragdolling),
+		GET_STATFNAME(STAT_AlsPhysicsQueries_Camera),
+		GET_STATFNAME(STAT_AlsPhysicsQueries_Footsteps)
+	};
+
+	static const FName CategoryDeferredQueriesStats[]
+	{
+		GET_STATFNAME(STAT_AlsPhysicsQueries_FootIkDeferred),
+		GET_STATFNAME(STAT_AlsPhysicsQueries_GroundPredictionDeferred),
+		GET_STATFNAME(STAT_AlsPhysicsQueries_MantlingDeferred),
+		GET_STATFNAME(STAT_AlsPhysicsQueries_RagdollingDeferred),
+		GET_STATFNAME(STAT_AlsPhysicsQueries_CameraDeferred),
+		GET_STATFNAME(STAT_AlsPhysicsQueries_FootstepsDeferred)
+	};
+#endif
+
+	RefreshFrame();
+
+	const auto CategoryIndex{static_cast<uint8>(Category)};
+	auto& CategoryQueriesCount{CategoryQueriesCounts[CategoryIndex]};
+
+	if (bAllowDeferral)
+	{
+		// Less significant characters can use only a part of each budget, so that
+		// the remaining part is left for the more significant characters.
+
+		const auto BudgetShare{GetSignificanceBudgetShare(Significance)};
+		const auto CategoryBudget{GetCategoryBudget(Category)};
+
+		if ((CategoryBudget > 0 && CategoryQueriesCount.load(std::memory_order_relaxed) + QueriesCount >
+		     FMath::CeilToInt(static_cast<float>(CategoryBudget) * BudgetShare)) ||
+		    (GlobalBudget > 0 && GlobalQueriesCount.load(std::memory_order_relaxed) + QueriesCount >
+		     FMath::CeilToInt(static_cast<float>(GlobalBudget) * BudgetShare)))
+		{
+			INC_DWORD_STAT_BY(STAT_AlsPhysicsQueries_Deferred, QueriesCount)
+			INC_DWORD_STAT_FNAME_BY(CategoryDeferredQueriesStats[CategoryIndex], QueriesCount)
+
+#if ALS_TRACE_ENABLED
+			AlsPhysicsQuery::TraceQueries(Category, true, QueriesCount);
+#endif
+			return false;
+		}
+	}
+
+	CategoryQueriesCount.fetch_add(QueriesCount, std::memory_order_relaxed);
+	GlobalQueriesCount.fetch_add(QueriesCount, std::memory_order_relaxed);
+
+	INC_DWORD_STAT_BY(STAT_AlsPhysicsQueries, QueriesCount)
+	INC_DWORD_STAT_FNAME_BY(CategoryQueriesStats[CategoryIndex], QueriesCount)
+
+#if ALS_TRACE_ENABLED
+	AlsPhysicsQuery::TraceQueries(Category, false, QueriesCount);
+#endif
+	return true;
+}
+
+bool UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(const UWorld* World, const EAlsPhysicsQueryCategory Category,
+                                                       const EAlsSignificance Significance, const bool bAllowDeferral,
+                                                       const int32 QueriesCount)
+{
+	auto* PhysicsQuerySubsystem{IsValid(World) ? World->GetSubsystem<UAlsPhysicsQuerySubsystem>() : nullptr};
+
+	return !IsValid(PhysicsQuerySubsystem) ||
+	       PhysicsQuerySubsystem->TryAcquireQueries(Category, Significance, bAllowDeferral, QueriesCount);
+}
+
+void UAlsPhysicsQuerySubsystem::RefreshFrame()
+{
+	// The counters are reset lazily by the first query of each frame. A query made by another thread during
+	// the reset may be lost, which only makes the budgets slightly less strict for that frame.
+
+	const auto CurrentFrameNumber{GFrameCounter};
+	auto PreviousFrameNumber{FrameNumber.load(std::memory_order_relaxed)};
+
+	if (PreviousFrameNumber == CurrentFrameNumber ||
+	    !FrameNumber.compare_exchange_strong(PreviousFrameNumber, CurrentFrameNumber, std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	GlobalQueriesCount.store(0, std::memory_order_relaxed);
+
+	for (auto& CategoryQueriesCount : CategoryQueriesCounts)
+	{
+		CategoryQueriesCount.store(0, std::memory_order_relaxed);
+	}
+}
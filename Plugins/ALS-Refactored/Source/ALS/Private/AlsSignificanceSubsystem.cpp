@@ -0,0 +1,220 @@
+#include "AlsSignificanceSubsystem.h"
+
+#include "AlsCharacter.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Settings/AlsCharacterSettings.h"
+#include "Utility/AlsTrace.h"
+#include "Utility/AlsUtility.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Critical Significance Characters"), STAT_AlsSignificance_Critical, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("High Significance Characters"), STAT_AlsSignificance_High, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Medium Significance Characters"), STAT_AlsSignificance_Medium, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Low Significance Characters"), STAT_AlsSignificance_Low, STATGROUP_Als)
+
+namespace AlsSignificanceSubsystemConstants
+{
+	static constexpr auto UpdateInterval{0.1f};
+}
+
+void UAlsSignificanceSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UpdateTimeRemaining -= DeltaTime;
+	if (UpdateTimeRemaining > 0.0f)
+	{
+		return;
+	}
+
+	UpdateTimeRemaining = AlsSignificanceSubsystemConstants::UpdateInterval;
+
+	RefreshViewLocations();
+
+	int32 CharactersCount[static_cast<uint8>(EAlsSignificance::Low) + 1]{};
+
+	TArray<AAlsCharacter*, TInlineAllocator<16>> RagdollingCharacters;
+
+	for (auto* Character : Characters)
+	{
+		if (!IsValid(Character))
+		{
+			continue;
+		}
+
+		const auto Significance{CalculateSignificance(Character)};
+
+		Character->SetSignificance(Significance, CalculateViewerDistance(Character));
+
+		CharactersCount[static_cast<uint8>(Significance)] += 1;
+
+		if (IsValid(Character->GetSettings()) &&
+		    Character->GetCompiledState().GetLocomotionAction() == EAlsCompiledLocomotionAction::Ragdolling)
+		{
+			RagdollingCharacters.Add(Character);
+		}
+	}
+
+	RefreshRagdollsFullSimulation(RagdollingCharacters);
+
+	SET_DWORD_STAT(STAT_AlsSignificance_Critical, CharactersCount[static_cast<uint8>(EAlsSignificance::Critical)]);
+	SET_DWORD_STAT(STAT_AlsSignificance_High, CharactersCount[static_cast<uint8>(EAlsSignificance::High)]);
+	SET_DWORD_STAT(STAT_AlsSignificance_Medium, CharactersCount[static_cast<uint8>(EAlsSignificance::Medium)]);
+	SET_DWORD_STAT(STAT_AlsSignificance_Low, CharactersCount[static_cast<uint8>(EAlsSignificance::Low)]);
+}
+
+TStatId UAlsSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAlsSignificanceSubsystem, STATGROUP_Als)
+}
+
+bool UAlsSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsSignificanceSubsystem::RegisterCharacter(AAlsCharacter* Character)
+{
+	if (IsValid(Character))
+	{
+		Characters.AddUnique(Character);
+
+		// Force the significance to be recalculated on the next tick so that the new character doesn't wait for it for too long.
+
+		UpdateTimeRemaining = 0.0f;
+	}
+}
+
+void UAlsSignificanceSubsystem::UnregisterCharacter(AAlsCharacter* Character)
+{
+	Characters.RemoveSingleSwap(Character);
+}
+
+void UAlsSignificanceSubsystem::RefreshViewLocations()
+{
+	ALS_TRACE_SCOPE(UAlsSignificanceSubsystem_RefreshViewLocations)
+
+	ViewLocations.Reset();
+	ViewPlayerControllers.Reset();
+
+	// On the server this also includes player controllers of remote clients, so characters
+	// near the remote players will be significant even if there are no local viewers.
+
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* PlayerController{Iterator->Get()};
+		if (!IsValid(PlayerController))
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		ViewLocations.Add(ViewLocation);
+		ViewPlayerControllers.Add(PlayerController);
+	}
+}
+
+EAlsSignificance UAlsSignificanceSubsystem::CalculateSignificance(const AAlsCharacter* Character) const
+{
+	// Characters controlled by a remote client must always be fully updated on the server, otherwise some problems may
+	// arise (such as jitter when rolling). AI controlled characters are also locally controlled on the server and in
+	// standalone, so only the local players are excluded here.
+
+	if (!IsValid(Character->GetSettings()) || (Character->IsLocallyControlled() && Character->IsPlayerControlled()) ||
+	    Character->GetLocomotionAction().IsValid() ||
+	    (Character->GetLocalRole() >= ROLE_Authority && Character->GetRemoteRole() == ROLE_AutonomousProxy))
+	{
+		return EAlsSignificance::Critical;
+	}
+
+	const auto& SignificanceSettings{Character->GetSettings()->Significance};
+	const auto CharacterLocation{Character->GetActorLocation()};
+
+	auto ViewDistanceSquared{TNumericLimits<FVector::FReal>::Max()};
+
+	for (const auto& ViewLocation : ViewLocations)
+	{
+		ViewDistanceSquared = FMath::Min(ViewDistanceSquared, FVector::DistSquared(CharacterLocation, ViewLocation));
+	}
+
+	auto Significance{EAlsSignificance::Low};
+
+	if (ViewDistanceSquared <= FMath::Square(SignificanceSettings.HighSignificanceDistance))
+	{
+		Significance = EAlsSignificance::High;
+	}
+	else if (ViewDistanceSquared <= FMath::Square(SignificanceSettings.MediumSignificanceDistance))
+	{
+		Significance = EAlsSignificance::Medium;
+	}
+
+	// Nothing is rendered on a dedicated server, so visibility is not taken into account there.
+
+	if (SignificanceSettings.bLowerSignificanceWhenNotRendered && Significance != EAlsSignificance::Low &&
+	    !Character->IsNetMode(NM_DedicatedServer) && !Character->GetMesh()->WasRecentlyRendered())
+	{
+		Significance = static_cast<EAlsSignificance>(static_cast<uint8>(Significance) + 1);
+	}
+
+	return Significance;
+}
+
+void UAlsSignificanceSubsystem::RefreshRagdollsFullSimulation(TArrayView<AAlsCharacter*> RagdollingCharacters) const
+{
+	ALS_TRACE_SCOPE(UAlsSignificanceSubsystem_RefreshRagdollsFullSimulation)
+
+	if (MaxFullySimulatedRagdolls <= 0)
+	{
+		for (auto* Character : RagdollingCharacters)
+		{
+			Character->SetRagdollFullSimulationAllowed(true);
+		}
+
+		return;
+	}
+
+	// Only the ragdolls closest to the viewers are fully simulated, with the ragdoll of a locally controlled player always first.
+
+	const auto CalculateRagdollPriority{
+		[](const AAlsCharacter& Character)
+		{
+			return Character.IsLocallyControlled() && Character.IsPlayerControlled()
+				       ? -1.0f
+				       : Character.GetSignificanceState().ViewerDistance;
+		}
+	};
+
+	RagdollingCharacters.Sort([&CalculateRagdollPriority](const AAlsCharacter& A, const AAlsCharacter& B)
+	{
+		return CalculateRagdollPriority(A) < CalculateRagdollPriority(B);
+	});
+
+	for (auto i{0}; i < RagdollingCharacters.Num(); i++)
+	{
+		auto* Character{RagdollingCharacters[i]};
+
+		Character->SetRagdollFullSimulationAllowed(i < MaxFullySimulatedRagdolls);
+	}
+}
+
+float UAlsSignificanceSubsystem::CalculateViewerDistance(const AAlsCharacter* Character) const
+{
+	const auto CharacterLocation{Character->GetActorLocation()};
+
+	auto ViewerDistanceSquared{FMath::Square(static_cast<FVector::FReal>(TNumericLimits<float>::Max()))};
+
+	for (auto i{0}; i < ViewLocations.Num(); i++)
+	{
+		if (ViewPlayerControllers[i] != Character->GetController())
+		{
+			ViewerDistanceSquared = FMath::Min(ViewerDistanceSquared, FVector::DistSquared(CharacterLocation, ViewLocations[i]));
+		}
+	}
+
+	return UE_REAL_TO_FLOAT(FMath::Sqrt(ViewerDistanceSquared));
+}
@@ -1,7 +1,22 @@
 #include "Nodes/AlsAnimNode_CurvesBlend.h"
 
+#include "Animation/AnimClassInterface.h"
 #include "Animation/AnimInstanceProxy.h"
+#include "Animation/AnimNode_SequencePlayer.h"
+#include "Animation/AnimSequenceBase.h"
 #include "Utility/AlsEnumUtility.h"
+#include "Utility/AlsLog.h"
+#include "Utility/AlsUtility.h"
+
+DECLARE_CYCLE_STAT(TEXT("Curves Blend Full Evaluation"), STAT_AlsCurvesBlend_FullEvaluation, STATGROUP_Als)
+DECLARE_CYCLE_STAT(TEXT("Curves Blend Curves Only Evaluation"), STAT_AlsCurvesBlend_CurvesOnlyEvaluation, STATGROUP_Als)
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Curves Blend Curves Only Time Saved (ms)"), STAT_AlsCurvesBlend_TimeSaved, STATGROUP_Als)
+
+namespace AlsCurvesBlendConstants
+{
+	// How often the full evaluation is additionally done to measure the time saved by the curves only evaluation.
+	static constexpr auto TimeSavedSampleInterval{32};
+}
 
 void FAlsAnimNode_CurvesBlend::Initialize_AnyThread(const FAnimationInitializeContext& Context)
 {
@@ -11,6 +26,38 @@ void FAlsAnimNode_CurvesBlend::Initialize_AnyThread(const FAnimationInitializeCo
 
 	SourcePose.Initialize(Context);
 	CurvesPose.Initialize(Context);
+
+	CurvesSequencePlayer = nullptr;
+
+	if (!bEvaluateCurvesOnly || CurvesPose.GetLinkNode() == nullptr)
+	{
+		return;
+	}
+
+	// Find out the type of the linked node in the same way as FPoseLinkBase::AttemptRelink() does.
+
+	const auto* AnimationClass{Context.AnimInstanceProxy->GetAnimClassInterface()};
+	if (AnimationClass == nullptr)
+	{
+		return;
+	}
+
+	const auto& NodeProperties{AnimationClass->GetAnimNodeProperties()};
+	const auto NodeIndex{NodeProperties.Num() - 1 - CurvesPose.LinkID};
+
+	if (NodeProperties.IsValidIndex(NodeIndex) &&
+	    NodeProperties[NodeIndex]->Struct->IsChildOf(FAnimNode_SequencePlayerBase::StaticStruct()))
+	{
+		CurvesSequencePlayer = static_cast<FAnimNode_SequencePlayerBase*>(CurvesPose.GetLinkNode());
+	}
+	else if (!bCurvesOnlyFallbackLogged)
+	{
+		bCurvesOnlyFallbackLogged = true;
+
+		UE_LOG(LogAls, Warning, TEXT("%s: %s: the curves pose is not directly linked to a sequence player, so it will be"
+		                             " fully evaluated even though Evaluate Curves Only is checked."),
+		       ANSI_TO_TCHAR(__FUNCTION__), *GetNameSafe(IAnimClassInterface::GetActualAnimClass(AnimationClass)));
+	}
 }
 
 void FAlsAnimNode_CurvesBlend::CacheBones_AnyThread(const FAnimationCacheBonesContext& Context)
@@ -57,35 +104,60 @@ void FAlsAnimNode_CurvesBlend::Evaluate_AnyThread(FPoseContext& Output)
 		return;
 	}
 
-	auto CurvesPoseContext{Output};
-	CurvesPose.Evaluate(CurvesPoseContext);
+	const auto* CurvesSequence{CurvesSequencePlayer != nullptr ? CurvesSequencePlayer->GetSequence() : nullptr};
 
-	switch (GetBlendMode())
+	if (CanEvaluateCurvesOnly(CurvesSequence))
 	{
-		case EAlsCurvesBlendMode::BlendByAmount:
-			Output.Curve.Accumulate(CurvesPoseContext.Curve, CurrentBlendAmount);
-			break;
+#if STATS
+		const auto CurvesOnlyStartCycles{FPlatformTime::Cycles()};
+#endif
 
-		case EAlsCurvesBlendMode::Combine:
-			Output.Curve.Combine(CurvesPoseContext.Curve);
-			break;
+		{
+			SCOPE_CYCLE_COUNTER(STAT_AlsCurvesBlend_CurvesOnlyEvaluation)
 
-		case EAlsCurvesBlendMode::CombinePreserved:
-			Output.Curve.CombinePreserved(CurvesPoseContext.Curve);
-			break;
+			// The curve is allocated on the animation memory stack, just like the pose context curve.
 
-		case EAlsCurvesBlendMode::UseMaxValue:
-			Output.Curve.UseMaxValue(CurvesPoseContext.Curve);
-			break;
+			FBlendedCurve Curve;
+			Curve.InitFrom(Output.Curve);
 
-		case EAlsCurvesBlendMode::UseMinValue:
-			Output.Curve.UseMinValue(CurvesPoseContext.Curve);
-			break;
+			EvaluateCurvesOnly(CurvesSequence, CurvesSequencePlayer->GetAccumulatedTime(), Curve);
 
-		case EAlsCurvesBlendMode::Override:
-			Output.Curve.Override(CurvesPoseContext.Curve);
-			break;
+			BlendCurves(Output.Curve, Curve, CurrentBlendAmount);
+		}
+
+#if STATS
+		const auto CurvesOnlyCycles{FPlatformTime::Cycles() - CurvesOnlyStartCycles};
+
+		// Every so often, also do the full evaluation that was skipped, just to measure how much time was saved.
+
+		if (FThreadStats::IsCollectingData() && ++TimeSavedSampleCounter >= AlsCurvesBlendConstants::TimeSavedSampleInterval)
+		{
+			TimeSavedSampleCounter = 0;
+
+			const auto FullStartCycles{FPlatformTime::Cycles()};
+
+			FPoseContext CurvesPoseContext{Output};
+			CurvesPose.Evaluate(CurvesPoseContext);
+
+			const auto FullCycles{FPlatformTime::Cycles() - FullStartCycles};
+
+			INC_FLOAT_STAT_BY(STAT_AlsCurvesBlend_TimeSaved,
+			                  (FPlatformTime::ToMilliseconds(FullCycles) - FPlatformTime::ToMilliseconds(CurvesOnlyCycles)) *
+			                  AlsCurvesBlendConstants::TimeSavedSampleInterval);
+		}
+#endif
+
+		return;
 	}
+
+	SCOPE_CYCLE_COUNTER(STAT_AlsCurvesBlend_FullEvaluation)
+
+	// This only copies the non-pose state of the output context, the pose itself is allocated on the animation memory stack.
+
+	FPoseContext CurvesPoseContext{Output};
+	CurvesPose.Evaluate(CurvesPoseContext);
+
+	BlendCurves(Output.Curve, CurvesPoseContext.Curve, CurrentBlendAmount);
 }
 
 void FAlsAnimNode_CurvesBlend::GatherDebugData(FNodeDebugData& DebugData)
@@ -106,3 +178,46 @@ EAlsCurvesBlendMode FAlsAnimNode_CurvesBlend::GetBlendMode() const
 {
 	return GET_ANIM_NODE_DATA(EAlsCurvesBlendMode, BlendMode);
 }
+
+bool FAlsAnimNode_CurvesBlend::CanEvaluateCurvesOnly(const UAnimSequenceBase* Sequence)
+{
+	// The curves of additive sequences are converted to additive against the base pose during the
+	// full evaluation, which is not done by UAnimSequenceBase::EvaluateCurveData(), so they are not supported.
+
+	return IsValid(Sequence) && !Sequence->IsValidAdditive();
+}
+
+void FAlsAnimNode_CurvesBlend::EvaluateCurvesOnly(const UAnimSequenceBase* Sequence, const float Time, FBlendedCurve& Curve)
+{
+	Sequence->EvaluateCurveData(Curve, Time);
+}
+
+void FAlsAnimNode_CurvesBlend::BlendCurves(FBlendedCurve& Curve, const FBlendedCurve& OtherCurve, const float Amount) const
+{
+	switch (GetBlendMode())
+	{
+		case EAlsCurvesBlendMode::BlendByAmount:
+			Curve.Accumulate(OtherCurve, Amount);
+			break;
+
+		case EAlsCurvesBlendMode::Combine:
+			Curve.Combine(OtherCurve);
+			break;
+
+		case EAlsCurvesBlendMode::CombinePreserved:
+			Curve.CombinePreserved(OtherCurve);
+			break;
+
+		case EAlsCurvesBlendMode::UseMaxValue:
+			Curve.UseMaxValue(OtherCurve);
+			break;
+
+		case EAlsCurvesBlendMode::UseMinValue:
+			Curve.UseMinValue(OtherCurve);
+			break;
+
+		case EAlsCurvesBlendMode::Override:
+			Curve.Override(OtherCurve);
+			break;
+	}
+}
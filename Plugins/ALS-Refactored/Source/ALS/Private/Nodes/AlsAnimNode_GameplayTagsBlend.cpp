@@ -1,9 +1,43 @@
 #include "Nodes/AlsAnimNode_GameplayTagsBlend.h"
 
+#include "Utility/AlsTrace.h"
+
+void FAlsAnimNode_GameplayTagsBlend::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	Super::Initialize_AnyThread(Context);
+
+	TagIndices.Reset();
+
+	if (!bUseInertialBlend)
+	{
+		return;
+	}
+
+	const auto& CurrentTags{GetTags()};
+
+	TagIndices.Reserve(CurrentTags.Num());
+
+	for (auto i{0}; i < CurrentTags.Num(); i++)
+	{
+		// Keep the first occurrence of duplicate tags to match the behavior of TArray::Find().
+
+		if (!TagIndices.Contains(CurrentTags[i]))
+		{
+			TagIndices.Add(CurrentTags[i], i + 1);
+		}
+	}
+}
+
 int32 FAlsAnimNode_GameplayTagsBlend::GetActiveChildIndex()
 {
 	const auto& CurrentActiveTag{GetActiveTag()};
 
+	if (bUseInertialBlend)
+	{
+		const auto* ChildIndex{CurrentActiveTag.IsValid() ? TagIndices.Find(CurrentActiveTag) : nullptr};
+		return ChildIndex != nullptr ? *ChildIndex : 0;
+	}
+
 	return CurrentActiveTag.IsValid()
 		       ? GetTags().Find(CurrentActiveTag) + 1
 		       : 0;
@@ -43,4 +77,14 @@ void FAlsAnimNode_GameplayTagsBlend::RefreshPoses()
 		}
 	}
 }
+
+void FAlsAnimNode_GameplayTagsBlend::RefreshTransitionType()
+{
+	ALS_TRACE_SCOPE(FAlsAnimNode_GameplayTagsBlend_RefreshTransitionType)
+
+	// With inertialization, the blend list snaps the blend weights to the active pose and skips the evaluation of the
+	// inactive ones, while the pose transition is smoothed out by the inertialization node.
+
+	TransitionType = bUseInertialBlend ? EBlendListTransitionType::Inertialization : EBlendListTransitionType::StandardBlend;
+}
 #endif
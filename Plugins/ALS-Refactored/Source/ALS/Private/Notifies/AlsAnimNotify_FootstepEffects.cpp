@@ -1,6 +1,7 @@
 #include "Notifies/AlsAnimNotify_FootstepEffects.h"
 
 #include "AlsCharacter.h"
+#include "AlsPhysicsQuerySubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "NiagaraComponent.h"
 #include "NiagaraFunctionLibrary.h"
@@ -58,8 +59,14 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	FCollisionQueryParams QueryParameters{ANSI_TO_TCHAR(__FUNCTION__), true, Mesh->GetOwner()};
 	QueryParameters.bReturnPhysicalMaterial = true;
 
+	// If the trace is deferred, the effects are spawned for the default surface at the foot location.
+
 	FHitResult Hit;
-	if (World->LineTraceSingleByChannel(Hit, FootTransform.GetLocation(),
+	if (UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(World, EAlsPhysicsQueryCategory::Footsteps,
+	                                                      IsValid(Character)
+		                                                      ? Character->GetSignificanceState().Significance
+		                                                      : EAlsSignificance::Critical) &&
+	    World->LineTraceSingleByChannel(Hit, FootTransform.GetLocation(),
 	                                    FootTransform.GetLocation() - FootZAxis *
 	                                    (FootstepEffectsSettings->SurfaceTraceDistance * MeshScale),
 	                                    UEngineTypes::ConvertToCollisionChannel(FootstepEffectsSettings->SurfaceTraceChannel),
@@ -56,7 +56,7 @@ void FAlsRootMotionSource_Mantling::PrepareRootMotion(const float SimulationDelt
 	FVector LocationOffset;
 	FRotator RotationOffset;
 
-	const auto BlendInAmount{MantlingSettings->BlendInCurve->GetFloatValue(MantlingTime)};
+	const auto BlendInAmount{MantlingSettings->BakedBlendInCurve.Evaluate(MantlingSettings->BlendInCurve, MantlingTime)};
 
 	if (!FAnimWeight::IsRelevant(BlendInAmount))
 	{
@@ -66,8 +66,8 @@ void FAlsRootMotionSource_Mantling::PrepareRootMotion(const float SimulationDelt
 	else
 	{
 		const FVector3f InterpolationAndCorrectionAmounts{
-			MantlingSettings->InterpolationAndCorrectionAmountsCurve->GetVectorValue(
-				MantlingTime + MantlingSettings->CalculateStartTime(MantlingHeight))
+			MantlingSettings->BakedInterpolationAndCorrectionAmountsCurve.Evaluate(
+				MantlingSettings->InterpolationAndCorrectionAmountsCurve, MantlingTime + MantlingSettings->CalculateStartTime(MantlingHeight))
 		};
 
 		const auto InterpolationAmount{InterpolationAndCorrectionAmounts.X};
@@ -1,7 +1,24 @@
 ﻿#include "Settings/AlsAnimationInstanceSettings.h"
 
+#include "Curves/CurveFloat.h"
 #include "Engine/CollisionProfile.h"
 
+void FAlsGroundedSettings::BakeCurves()
+{
+	BakedStrideBlendAmountWalkCurve.Bake(StrideBlendAmountWalkCurve);
+	BakedStrideBlendAmountRunCurve.Bake(StrideBlendAmountRunCurve);
+	BakedRotationYawOffsetForwardCurve.Bake(RotationYawOffsetForwardCurve);
+	BakedRotationYawOffsetBackwardCurve.Bake(RotationYawOffsetBackwardCurve);
+	BakedRotationYawOffsetLeftCurve.Bake(RotationYawOffsetLeftCurve);
+	BakedRotationYawOffsetRightCurve.Bake(RotationYawOffsetRightCurve);
+}
+
+void FAlsInAirSettings::BakeCurves()
+{
+	BakedLeanAmountCurve.Bake(LeanAmountCurve);
+	BakedGroundPredictionAmountCurve.Bake(GroundPredictionAmountCurve);
+}
+
 UAlsAnimationInstanceSettings::UAlsAnimationInstanceSettings()
 {
 	InAir.GroundPredictionSweepObjectTypes =
@@ -11,3 +28,25 @@ UAlsAnimationInstanceSettings::UAlsAnimationInstanceSettings()
 		UCollisionProfile::Get()->ConvertToObjectType(ECC_Destructible)
 	};
 }
+
+void UAlsAnimationInstanceSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	BakeCurves();
+}
+
+#if WITH_EDITOR
+void UAlsAnimationInstanceSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	BakeCurves();
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+void UAlsAnimationInstanceSettings::BakeCurves()
+{
+	Grounded.BakeCurves();
+	InAir.BakeCurves();
+}
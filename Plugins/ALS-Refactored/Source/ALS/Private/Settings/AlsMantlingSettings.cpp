@@ -0,0 +1,26 @@
+#include "Settings/AlsMantlingSettings.h"
+
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+
+void UAlsMantlingSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	BakeCurves();
+}
+
+#if WITH_EDITOR
+void UAlsMantlingSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	BakeCurves();
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+void UAlsMantlingSettings::BakeCurves()
+{
+	BakedBlendInCurve.Bake(BlendInCurve);
+	BakedInterpolationAndCorrectionAmountsCurve.Bake(InterpolationAndCorrectionAmountsCurve);
+}
@@ -0,0 +1,37 @@
+#include "Settings/AlsMovementSettings.h"
+
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+
+void FAlsMovementGaitSettings::BakeCurves()
+{
+	BakedAccelerationAndDecelerationAndGroundFrictionCurve.Bake(AccelerationAndDecelerationAndGroundFrictionCurve);
+	BakedRotationInterpolationSpeedCurve.Bake(RotationInterpolationSpeedCurve);
+}
+
+void UAlsMovementSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	BakeCurves();
+}
+
+#if WITH_EDITOR
+void UAlsMovementSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	BakeCurves();
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+void UAlsMovementSettings::BakeCurves()
+{
+	for (auto& RotationMode : RotationModes)
+	{
+		for (auto& Stance : RotationMode.Value.Stances)
+		{
+			Stance.Value.BakeCurves();
+		}
+	}
+}
@@ -0,0 +1,32 @@
+#include "State/AlsActionEventsState.h"
+
+void FAlsActionEventsState::AddEvent(const FAlsActionEvent& Event)
+{
+	SequenceNumber += 1;
+
+	// Copy only the payload used by the event type, so that unchanged fields of the overwritten event are not replicated again.
+
+	auto& NewEvent{Events[SequenceNumber % Capacity]};
+	NewEvent.Type = Event.Type;
+
+	switch (Event.Type)
+	{
+		case EAlsActionEventType::LockRotation:
+			NewEvent.TargetYawAngle = Event.TargetYawAngle;
+			break;
+
+		case EAlsActionEventType::StartRolling:
+			NewEvent.Montage = Event.Montage;
+			NewEvent.PlayRate = Event.PlayRate;
+			NewEvent.StartYawAngle = Event.StartYawAngle;
+			NewEvent.TargetYawAngle = Event.TargetYawAngle;
+			break;
+
+		case EAlsActionEventType::StartMantling:
+			NewEvent.MantlingParameters = Event.MantlingParameters;
+			break;
+
+		default:
+			break;
+	}
+}
@@ -0,0 +1,156 @@
+#include "State/AlsCompiledState.h"
+
+#include "Utility/AlsGameplayTags.h"
+
+namespace AlsCompiledState
+{
+	// The tags must be listed in the same order as the values of the corresponding compiled enumeration.
+
+	static const FNativeGameplayTag* const ViewModeTags[]
+	{
+		&AlsViewModeTags::FirstPerson,
+		&AlsViewModeTags::ThirdPerson
+	};
+
+	static const FNativeGameplayTag* const LocomotionModeTags[]
+	{
+		&AlsLocomotionModeTags::Grounded,
+		&AlsLocomotionModeTags::InAir
+	};
+
+	static const FNativeGameplayTag* const RotationModeTags[]
+	{
+		&AlsRotationModeTags::LookingDirection,
+		&AlsRotationModeTags::VelocityDirection,
+		&AlsRotationModeTags::Aiming
+	};
+
+	static const FNativeGameplayTag* const StanceTags[]
+	{
+		&AlsStanceTags::Standing,
+		&AlsStanceTags::Crouching
+	};
+
+	static const FNativeGameplayTag* const GaitTags[]
+	{
+		&AlsGaitTags::Walking,
+		&AlsGaitTags::Running,
+		&AlsGaitTags::Sprinting
+	};
+
+	static const FNativeGameplayTag* const OverlayModeTags[]
+	{
+		&AlsOverlayModeTags::Default,
+		&AlsOverlayModeTags::Masculine,
+		&AlsOverlayModeTags::Feminine,
+		&AlsOverlayModeTags::Injured,
+		&AlsOverlayModeTags::HandsTied,
+		&AlsOverlayModeTags::M4,
+		&AlsOverlayModeTags::PistolOneHanded,
+		&AlsOverlayModeTags::PistolTwoHanded,
+		&AlsOverlayModeTags::Bow,
+		&AlsOverlayModeTags::Torch,
+		&AlsOverlayModeTags::Binoculars,
+		&AlsOverlayModeTags::Box,
+		&AlsOverlayModeTags::Barrel
+	};
+
+	static const FNativeGameplayTag* const LocomotionActionTags[]
+	{
+		&AlsLocomotionActionTags::Rolling,
+		&AlsLocomotionActionTags::Mantling,
+		&AlsLocomotionActionTags::Ragdolling,
+		&AlsLocomotionActionTags::GettingUp
+	};
+
+	TConstArrayView<const FNativeGameplayTag*> GetViewModeTags()
+	{
+		return ViewModeTags;
+	}
+
+	TConstArrayView<const FNativeGameplayTag*> GetLocomotionModeTags()
+	{
+		return LocomotionModeTags;
+	}
+
+	TConstArrayView<const FNativeGameplayTag*> GetRotationModeTags()
+	{
+		return RotationModeTags;
+	}
+
+	TConstArrayView<const FNativeGameplayTag*> GetStanceTags()
+	{
+		return StanceTags;
+	}
+
+	TConstArrayView<const FNativeGameplayTag*> GetGaitTags()
+	{
+		return GaitTags;
+	}
+
+	TConstArrayView<const FNativeGameplayTag*> GetOverlayModeTags()
+	{
+		return OverlayModeTags;
+	}
+
+	TConstArrayView<const FNativeGameplayTag*> GetLocomotionActionTags()
+	{
+		return LocomotionActionTags;
+	}
+
+	template <typename EnumType, int32 TagsCount>
+	static uint8 Compile(const FGameplayTag& Tag, const FNativeGameplayTag* const (&Tags)[TagsCount])
+	{
+		static_assert(static_cast<int32>(EnumType::None) == 0 && static_cast<int32>(EnumType::Custom) == TagsCount + 1);
+
+		if (!Tag.IsValid())
+		{
+			return static_cast<uint8>(EnumType::None);
+		}
+
+		for (auto i{0}; i < TagsCount; i++)
+		{
+			if (Tag == Tags[i]->GetTag())
+			{
+				return static_cast<uint8>(i + 1);
+			}
+		}
+
+		return static_cast<uint8>(EnumType::Custom);
+	}
+}
+
+void FAlsCompiledState::SetViewMode(const FGameplayTag& NewModeTag)
+{
+	ViewMode = AlsCompiledState::Compile<EAlsCompiledViewMode>(NewModeTag, AlsCompiledState::ViewModeTags);
+}
+
+void FAlsCompiledState::SetLocomotionMode(const FGameplayTag& NewModeTag)
+{
+	LocomotionMode = AlsCompiledState::Compile<EAlsCompiledLocomotionMode>(NewModeTag, AlsCompiledState::LocomotionModeTags);
+}
+
+void FAlsCompiledState::SetRotationMode(const FGameplayTag& NewModeTag)
+{
+	RotationMode = AlsCompiledState::Compile<EAlsCompiledRotationMode>(NewModeTag, AlsCompiledState::RotationModeTags);
+}
+
+void FAlsCompiledState::SetStance(const FGameplayTag& NewStanceTag)
+{
+	Stance = AlsCompiledState::Compile<EAlsCompiledStance>(NewStanceTag, AlsCompiledState::StanceTags);
+}
+
+void FAlsCompiledState::SetGait(const FGameplayTag& NewGaitTag)
+{
+	Gait = AlsCompiledState::Compile<EAlsCompiledGait>(NewGaitTag, AlsCompiledState::GaitTags);
+}
+
+void FAlsCompiledState::SetOverlayMode(const FGameplayTag& NewModeTag)
+{
+	OverlayMode = AlsCompiledState::Compile<EAlsCompiledOverlayMode>(NewModeTag, AlsCompiledState::OverlayModeTags);
+}
+
+void FAlsCompiledState::SetLocomotionAction(const FGameplayTag& NewActionTag)
+{
+	LocomotionAction = AlsCompiledState::Compile<EAlsCompiledLocomotionAction>(NewActionTag, AlsCompiledState::LocomotionActionTags);
+}
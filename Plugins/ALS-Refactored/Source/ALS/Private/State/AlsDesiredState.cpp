@@ -0,0 +1,64 @@
+#include "State/AlsDesiredState.h"
+
+#include "State/AlsCompiledState.h"
+
+namespace AlsDesiredState
+{
+	// Index 0 is used for an empty tag, indices from 1 to the number of built-in tags are used for built-in
+	// tags, and the last index is used as an escape value for a custom tag, which is serialized separately.
+
+	static void NetSerializeTag(FArchive& Archive, UPackageMap* Map, FGameplayTag& Tag,
+	                            const TConstArrayView<const FNativeGameplayTag*> BuiltInTags, bool& bSuccess)
+	{
+		const auto CustomTagIndex{static_cast<uint32>(BuiltInTags.Num() + 1)};
+
+		uint32 TagIndex{0};
+
+		if (Archive.IsSaving() && Tag.IsValid())
+		{
+			TagIndex = CustomTagIndex;
+
+			for (auto i{0}; i < BuiltInTags.Num(); i++)
+			{
+				if (Tag == BuiltInTags[i]->GetTag())
+				{
+					TagIndex = static_cast<uint32>(i + 1);
+					break;
+				}
+			}
+		}
+
+		Archive.SerializeInt(TagIndex, CustomTagIndex + 1);
+
+		if (TagIndex == CustomTagIndex)
+		{
+			auto bTagSuccess{true};
+			Tag.NetSerialize(Archive, Map, bTagSuccess);
+
+			bSuccess &= bTagSuccess;
+		}
+		else if (Archive.IsLoading())
+		{
+			Tag = TagIndex > 0 ? BuiltInTags[TagIndex - 1]->GetTag() : FGameplayTag::EmptyTag;
+		}
+	}
+}
+
+bool FAlsDesiredState::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	bSuccess = true;
+
+	uint8 bAimingByte{bAiming};
+	Archive.SerializeBits(&bAimingByte, 1);
+	bAiming = (bAimingByte & 1) > 0;
+
+	AlsDesiredState::NetSerializeTag(Archive, Map, RotationMode, AlsCompiledState::GetRotationModeTags(), bSuccess);
+	AlsDesiredState::NetSerializeTag(Archive, Map, Stance, AlsCompiledState::GetStanceTags(), bSuccess);
+	AlsDesiredState::NetSerializeTag(Archive, Map, Gait, AlsCompiledState::GetGaitTags(), bSuccess);
+	AlsDesiredState::NetSerializeTag(Archive, Map, ViewMode, AlsCompiledState::GetViewModeTags(), bSuccess);
+	AlsDesiredState::NetSerializeTag(Archive, Map, OverlayMode, AlsCompiledState::GetOverlayModeTags(), bSuccess);
+
+	bSuccess &= !Archive.IsError();
+
+	return bSuccess;
+}
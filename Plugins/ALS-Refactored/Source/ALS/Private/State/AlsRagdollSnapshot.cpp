@@ -0,0 +1,28 @@
+#include "State/AlsRagdollSnapshot.h"
+
+#include "Engine/NetSerialization.h"
+
+bool FAlsRagdollSnapshot::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	bSuccess = true;
+
+	auto BodiesCount{static_cast<uint32>(FMath::Min(Bodies.Num(), MaxBodies))};
+	Archive.SerializeInt(BodiesCount, MaxBodies + 1);
+
+	if (Archive.IsLoading())
+	{
+		Bodies.SetNum(static_cast<int32>(BodiesCount));
+	}
+
+	for (auto i{0}; i < static_cast<int32>(BodiesCount); i++)
+	{
+		auto& Body{Bodies[i]};
+
+		bSuccess &= SerializePackedVector<10, 24>(Body.Location, Archive);
+		Body.Rotation.SerializeCompressedShort(Archive);
+	}
+
+	bSuccess &= !Archive.IsError();
+
+	return bSuccess;
+}
@@ -0,0 +1,116 @@
+#include "State/AlsViewState.h"
+
+void FAlsViewNetworkSmoothingBuffer::Reset()
+{
+	SamplesCount = 0;
+	LastSampleIndex = 0;
+}
+
+void FAlsViewNetworkSmoothingBuffer::AddSample(const float ServerTime, const FRotator& Rotation)
+{
+	if (SamplesCount > 0)
+	{
+		auto& LastSample{Samples[LastSampleIndex]};
+
+		if (ServerTime <= LastSample.ServerTime)
+		{
+			if (FMath::IsNearlyEqual(ServerTime, LastSample.ServerTime))
+			{
+				LastSample.Rotation = Rotation;
+			}
+
+			return;
+		}
+	}
+
+	LastSampleIndex = (LastSampleIndex + 1) % UE_ARRAY_COUNT(Samples);
+	SamplesCount = FMath::Min(SamplesCount + 1, static_cast<int32>(UE_ARRAY_COUNT(Samples)));
+
+	auto& NewSample{Samples[LastSampleIndex]};
+	NewSample.ServerTime = ServerTime;
+	NewSample.Rotation = Rotation;
+}
+
+FRotator FAlsViewNetworkSmoothingBuffer::Evaluate(const float ServerTime, const float MaxExtrapolationTime) const
+{
+	if (SamplesCount <= 0)
+	{
+		return FRotator::ZeroRotator;
+	}
+
+	const auto& FirstSample{GetSample(0)};
+	const auto& LastSample{GetSample(SamplesCount - 1)};
+
+	if (SamplesCount == 1 || ServerTime <= FirstSample.ServerTime)
+	{
+		return SamplesCount == 1 ? LastSample.Rotation : FirstSample.Rotation;
+	}
+
+	if (ServerTime >= LastSample.ServerTime)
+	{
+		// The rotation is extrapolated for at most the maximum extrapolation time and then returns to the last rotation over
+		// the same time, otherwise it would stay offset forever if the view stops turning, since nothing new is received then.
+
+		const auto ElapsedTime{ServerTime - LastSample.ServerTime};
+
+		const auto ExtrapolationTime{
+			ElapsedTime <= MaxExtrapolationTime ? ElapsedTime : FMath::Max(0.0f, 2.0f * MaxExtrapolationTime - ElapsedTime)
+		};
+
+		if (ExtrapolationTime <= 0.0f)
+		{
+			return LastSample.Rotation;
+		}
+
+		const auto& PreviousSample{GetSample(SamplesCount - 2)};
+
+		const auto AngularVelocity{
+			(LastSample.Rotation - PreviousSample.Rotation).GetNormalized() *
+			(1.0f / (LastSample.ServerTime - PreviousSample.ServerTime))
+		};
+
+		return (LastSample.Rotation + AngularVelocity * ExtrapolationTime).GetNormalized();
+	}
+
+	auto SegmentIndex{0};
+
+	while (ServerTime > GetSample(SegmentIndex + 1).ServerTime)
+	{
+		SegmentIndex += 1;
+	}
+
+	// Rotations are unwound relative to the start of the segment, so the spline doesn't take the long way around.
+
+	const auto& StartSample{GetSample(SegmentIndex)};
+	const auto& EndSample{GetSample(SegmentIndex + 1)};
+
+	const auto SegmentDuration{EndSample.ServerTime - StartSample.ServerTime};
+	const auto SegmentDelta{(EndSample.Rotation - StartSample.Rotation).GetNormalized()};
+
+	// Catmull-Rom style tangents for non-uniform sample times. The outer samples use the segment slope instead.
+
+	auto StartTangent{SegmentDelta};
+
+	if (SegmentIndex > 0)
+	{
+		const auto& PreviousSample{GetSample(SegmentIndex - 1)};
+
+		StartTangent = (SegmentDelta + (StartSample.Rotation - PreviousSample.Rotation).GetNormalized()) *
+		               (SegmentDuration / (EndSample.ServerTime - PreviousSample.ServerTime));
+	}
+
+	auto EndTangent{SegmentDelta};
+
+	if (SegmentIndex + 2 < SamplesCount)
+	{
+		const auto& NextSample{GetSample(SegmentIndex + 2)};
+
+		EndTangent = (SegmentDelta + (NextSample.Rotation - EndSample.Rotation).GetNormalized()) *
+		             (SegmentDuration / (NextSample.ServerTime - StartSample.ServerTime));
+	}
+
+	const auto InterpolationAmount{(ServerTime - StartSample.ServerTime) / SegmentDuration};
+
+	return FMath::CubicInterp(StartSample.Rotation, StartTangent, StartSample.Rotation + SegmentDelta,
+	                          EndTangent, InterpolationAmount).GetNormalized();
+}
@@ -0,0 +1,270 @@
+#include "Misc/AutomationTest.h"
+#include "State/AlsActionEventsState.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsActionEventsTests
+{
+	static constexpr auto FramesCount{3000};
+	static constexpr auto DrainFramesCount{100};
+
+	// One network update per frame, the packet latency is the same in both directions.
+	static constexpr auto LatencyFrames{3};
+	static constexpr auto RoundTripFrames{LatencyFrames * 2};
+
+	static constexpr auto EventProbability{0.2f};
+	static constexpr auto BurstProbability{0.3f};
+	static constexpr auto BurstEventsCount{3};
+
+	struct FSchedule
+	{
+		TArray<int32> EventsCounts;
+
+		TArray<bool> PacketLosses;
+	};
+
+	struct FResult
+	{
+		int32 MaxReliableBunches{0};
+
+		float MeanReliableBunches{0.0f};
+
+		float MeanLatencyFrames{0.0f};
+
+		int32 EventsCount{0};
+
+		int32 LostEventsCount{0};
+	};
+
+	// Events and packet losses are generated once, so that both replication methods see the same conditions.
+	static FSchedule MakeSchedule(const float PacketLoss, const int32 Seed)
+	{
+		FRandomStream Random{Seed};
+		FSchedule Schedule;
+
+		for (auto Frame{0}; Frame < FramesCount + DrainFramesCount; Frame++)
+		{
+			auto EventsCount{0};
+
+			if (Frame < FramesCount && Random.FRand() < EventProbability)
+			{
+				EventsCount = Random.FRand() < BurstProbability ? BurstEventsCount : 1;
+			}
+
+			Schedule.EventsCounts.Add(EventsCount);
+			Schedule.PacketLosses.Add(Random.FRand() < PacketLoss);
+		}
+
+		return Schedule;
+	}
+
+	// Each event is sent as a reliable bunch, which stays in the reliable buffer until it is acknowledged and is resent when the packet
+	// carrying it is lost. The client processes the bunches in order, so a lost bunch also delays all the bunches that follow it.
+	static FResult SimulateReliableMulticast(const FSchedule& Schedule)
+	{
+		TArray<int32> EventCreationFrames;
+		TArray<int32> EventReceptionFrames;
+		TMultiMap<int32, int32> PendingResends;
+
+		FResult Result;
+		auto ProcessedEventsCount{0};
+		auto TotalLatencyFrames{0};
+		auto TotalReliableBunches{0};
+
+		for (auto Frame{0}; Frame < Schedule.EventsCounts.Num(); Frame++)
+		{
+			TArray<int32> Bunches;
+			PendingResends.MultiFind(Frame, Bunches, true);
+			PendingResends.Remove(Frame);
+
+			for (auto i{0}; i < Schedule.EventsCounts[Frame]; i++)
+			{
+				Bunches.Add(EventCreationFrames.Add(Frame));
+				EventReceptionFrames.Add(INDEX_NONE);
+			}
+
+			for (const auto Bunch : Bunches)
+			{
+				if (Schedule.PacketLosses[Frame])
+				{
+					PendingResends.Add(Frame + RoundTripFrames, Bunch);
+				}
+				else
+				{
+					EventReceptionFrames[Bunch] = Frame + LatencyFrames;
+				}
+			}
+
+			// A bunch is removed from the reliable buffer once its acknowledgment is received.
+
+			auto ReliableBunches{0};
+
+			for (const auto ReceptionFrame : EventReceptionFrames)
+			{
+				ReliableBunches += ReceptionFrame == INDEX_NONE || ReceptionFrame + LatencyFrames > Frame ? 1 : 0;
+			}
+
+			Result.MaxReliableBunches = FMath::Max(Result.MaxReliableBunches, ReliableBunches);
+			TotalReliableBunches += ReliableBunches;
+
+			while (ProcessedEventsCount < EventReceptionFrames.Num() && EventReceptionFrames[ProcessedEventsCount] != INDEX_NONE &&
+			       EventReceptionFrames[ProcessedEventsCount] <= Frame)
+			{
+				TotalLatencyFrames += Frame - EventCreationFrames[ProcessedEventsCount];
+				ProcessedEventsCount += 1;
+			}
+		}
+
+		Result.MeanReliableBunches = static_cast<float>(TotalReliableBunches) / Schedule.EventsCounts.Num();
+		Result.MeanLatencyFrames = static_cast<float>(TotalLatencyFrames) / FMath::Max(1, ProcessedEventsCount);
+		Result.EventsCount = EventCreationFrames.Num();
+		Result.LostEventsCount = EventCreationFrames.Num() - ProcessedEventsCount;
+
+		return Result;
+	}
+
+	// The events are written into the ring, which is sent as a property whenever it changes. When a packet carrying the
+	// property is lost, the current value of the property is resent. The client processes the ring as the character does, so
+	// events that were overwritten in the ring during a series of lost packets never reach the client.
+	static FResult SimulatePropertyReplication(const FSchedule& Schedule)
+	{
+		struct FPacket
+		{
+			int32 Frame{0};
+
+			bool bLost{false};
+
+			FAlsActionEventsState State;
+		};
+
+		FAlsActionEventsState ServerState;
+		uint8 AcknowledgedSequenceNumber{0};
+		uint8 SentSequenceNumber{0};
+
+		uint8 ProcessedSequenceNumber{0};
+
+		TArray<int32> EventCreationFrames;
+		TArray<bool> EventsProcessed;
+		TArray<FPacket> Packets;
+
+		FResult Result;
+		auto ProcessedEventsCount{0};
+		auto TotalLatencyFrames{0};
+
+		for (auto Frame{0}; Frame < Schedule.EventsCounts.Num(); Frame++)
+		{
+			for (auto i{0}; i < Schedule.EventsCounts[Frame]; i++)
+			{
+				// The event index is stored in the payload to identify the event on the client.
+
+				FAlsActionEvent Event;
+				Event.Type = EAlsActionEventType::LockRotation;
+				Event.TargetYawAngle = static_cast<float>(EventCreationFrames.Add(Frame));
+
+				ServerState.AddEvent(Event);
+				EventsProcessed.Add(false);
+			}
+
+			auto bResendRequired{false};
+
+			for (const auto& Packet : Packets)
+			{
+				if (Packet.Frame + RoundTripFrames == Frame)
+				{
+					if (Packet.bLost)
+					{
+						bResendRequired = true;
+					}
+					else
+					{
+						AcknowledgedSequenceNumber = Packet.State.SequenceNumber;
+					}
+				}
+			}
+
+			if ((bResendRequired || ServerState.SequenceNumber != SentSequenceNumber) &&
+			    ServerState.SequenceNumber != AcknowledgedSequenceNumber)
+			{
+				Packets.Add({Frame, Schedule.PacketLosses[Frame], ServerState});
+				SentSequenceNumber = ServerState.SequenceNumber;
+			}
+
+			for (const auto& Packet : Packets)
+			{
+				if (Packet.Frame + LatencyFrames != Frame || Packet.bLost ||
+				    Packet.State.GetEventsCountSince(ProcessedSequenceNumber) <= 0 ||
+				    static_cast<int8>(Packet.State.SequenceNumber - ProcessedSequenceNumber) <= 0)
+				{
+					continue;
+				}
+
+				// Same as AAlsCharacter::OnReplicated_ActionEvents().
+
+				const auto EventsCount{Packet.State.GetEventsCountSince(ProcessedSequenceNumber)};
+
+				auto SequenceNumber{static_cast<uint8>(Packet.State.SequenceNumber - EventsCount)};
+
+				while (SequenceNumber != Packet.State.SequenceNumber)
+				{
+					SequenceNumber += 1;
+
+					const auto EventIndex{FMath::RoundToInt(Packet.State.GetEvent(SequenceNumber).TargetYawAngle)};
+
+					EventsProcessed[EventIndex] = true;
+					TotalLatencyFrames += Frame - EventCreationFrames[EventIndex];
+					ProcessedEventsCount += 1;
+				}
+
+				ProcessedSequenceNumber = Packet.State.SequenceNumber;
+			}
+		}
+
+		Result.MeanLatencyFrames = static_cast<float>(TotalLatencyFrames) / FMath::Max(1, ProcessedEventsCount);
+		Result.EventsCount = EventCreationFrames.Num();
+		Result.LostEventsCount = EventCreationFrames.Num() - ProcessedEventsCount;
+
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsActionEventsPacketLossTest, "Als.State.ActionEvents.PacketLoss",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsActionEventsPacketLossTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsActionEventsTests;
+
+	for (const auto PacketLoss : {0.0f, 0.1f, 0.2f})
+	{
+		const auto Schedule{MakeSchedule(PacketLoss, 0)};
+
+		const auto ReliableResult{SimulateReliableMulticast(Schedule)};
+		const auto PropertyResult{SimulatePropertyReplication(Schedule)};
+
+		AddInfo(FString::Printf(TEXT("%.0f%% packet loss: reliable multicast uses up to %d (mean %.2f) reliable bunches with a mean ")
+		                        TEXT("latency of %.2f frames; property replication uses none with a mean latency of %.2f frames ")
+		                        TEXT("and loses %d of %d events."), PacketLoss * 100.0f, ReliableResult.MaxReliableBunches,
+		                        ReliableResult.MeanReliableBunches, ReliableResult.MeanLatencyFrames,
+		                        PropertyResult.MeanLatencyFrames, PropertyResult.LostEventsCount, PropertyResult.EventsCount));
+
+		TestEqual(FString::Printf(TEXT("Reliable multicast loses no events with %.0f%% packet loss"), PacketLoss * 100.0f),
+		          ReliableResult.LostEventsCount, 0);
+
+		// The ring is overwritten only when more events than its capacity occur during a series of lost packets.
+
+		TestTrue(FString::Printf(TEXT("Property replication loses at most 1%% of events with %.0f%% packet loss"), PacketLoss * 100.0f),
+		         PropertyResult.LostEventsCount * 100 <= PropertyResult.EventsCount);
+
+		if (PacketLoss <= 0.0f)
+		{
+			TestEqual(TEXT("Property replication loses no events without packet loss"), PropertyResult.LostEventsCount, 0);
+		}
+
+		TestTrue(FString::Printf(TEXT("Property replication is not slower with %.0f%% packet loss"), PacketLoss * 100.0f),
+		         PropertyResult.MeanLatencyFrames <= ReliableResult.MeanLatencyFrames);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,195 @@
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+#include "Misc/AutomationTest.h"
+#include "Utility/AlsBakedCurve.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsBakedCurveTests
+{
+	static constexpr auto EvaluationsCount{10000};
+
+	// The error is measured by the baking only in the middle between the samples, so a small margin is allowed elsewhere.
+	static constexpr auto ErrorMargin{2.0f};
+
+	static UCurveFloat* MakeFloatCurve()
+	{
+		auto* Curve{NewObject<UCurveFloat>(GetTransientPackage())};
+
+		Curve->FloatCurve.AddKey(0.0f, 0.0f);
+		Curve->FloatCurve.AddKey(0.3f, 1.5f);
+		Curve->FloatCurve.AddKey(0.7f, -0.5f);
+		Curve->FloatCurve.AddKey(1.0f, 2.0f);
+
+		for (auto Iterator{Curve->FloatCurve.GetKeyHandleIterator()}; Iterator; ++Iterator)
+		{
+			Curve->FloatCurve.SetKeyInterpMode(*Iterator, RCIM_Cubic);
+		}
+
+		return Curve;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsBakedCurveFloatAccuracyTest, "Als.Utility.BakedCurve.FloatAccuracy",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsBakedCurveFloatAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsBakedCurveTests;
+
+	const auto* Curve{MakeFloatCurve()};
+
+	FAlsBakedCurve BakedCurve;
+	BakedCurve.Bake(Curve);
+
+	if (!TestTrue(TEXT("Curve is baked"), BakedCurve.IsBakedFrom(Curve)))
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("Samples count is limited"), BakedCurve.GetSamplesCount() <= FAlsBakedCurve::DefaultMaxSamplesCount);
+
+	float MinValue, MaxValue;
+	Curve->FloatCurve.GetValueRange(MinValue, MaxValue);
+
+	const auto MaxAllowedError{FMath::Max(MaxValue - MinValue, 1.0f) * FAlsBakedCurve::DefaultMaxRelativeError * ErrorMargin};
+
+	TestTrue(TEXT("Measured error is within the allowed error"), BakedCurve.GetMaxError() <= MaxAllowedError);
+
+	// Also evaluate outside of the key range, where the constant extrapolation is emulated by clamping.
+
+	auto MaxError{0.0f};
+
+	for (auto i{0}; i <= EvaluationsCount; i++)
+	{
+		const auto Time{FMath::Lerp(-0.5f, 1.5f, static_cast<float>(i) / EvaluationsCount)};
+
+		MaxError = FMath::Max(MaxError, FMath::Abs(BakedCurve.Evaluate(Curve, Time) - Curve->GetFloatValue(Time)));
+	}
+
+	AddInfo(FString::Printf(TEXT("Samples: %d, maximum error: %f, allowed error: %f."),
+	                        BakedCurve.GetSamplesCount(), MaxError, MaxAllowedError));
+
+	TestTrue(TEXT("Evaluation error is within the allowed error"), MaxError <= MaxAllowedError);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsBakedCurveVectorAccuracyTest, "Als.Utility.BakedCurve.VectorAccuracy",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsBakedCurveVectorAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsBakedCurveTests;
+
+	auto* Curve{NewObject<UCurveVector>(GetTransientPackage())};
+
+	// Linear channels with different time and value ranges, one of them is empty. All keys lie
+	// on the sample grid, so the channels are represented by the lookup table almost exactly.
+
+	Curve->FloatCurves[0].AddKey(0.0f, 0.0f);
+	Curve->FloatCurves[0].AddKey(2.0f, 100.0f);
+	Curve->FloatCurves[1].AddKey(-1.0f, 1.0f);
+	Curve->FloatCurves[1].AddKey(1.0f, -1.0f);
+	Curve->FloatCurves[1].AddKey(3.0f, 0.0f);
+
+	FAlsBakedCurve BakedCurve;
+	BakedCurve.Bake(Curve);
+
+	if (!TestTrue(TEXT("Curve is baked"), BakedCurve.IsBakedFrom(Curve)))
+	{
+		return false;
+	}
+
+	for (auto Channel{0}; Channel < 3; Channel++)
+	{
+		float MinValue, MaxValue;
+		Curve->FloatCurves[Channel].GetValueRange(MinValue, MaxValue);
+
+		const auto MaxAllowedError{FMath::Max(MaxValue - MinValue, 1.0f) * FAlsBakedCurve::DefaultMaxRelativeError * ErrorMargin};
+
+		auto MaxError{0.0f};
+
+		for (auto i{0}; i <= EvaluationsCount; i++)
+		{
+			const auto Time{FMath::Lerp(-2.0f, 4.0f, static_cast<float>(i) / EvaluationsCount)};
+
+			MaxError = FMath::Max(MaxError, FMath::Abs(BakedCurve.Evaluate(Curve, Channel, Time) -
+			                                           Curve->FloatCurves[Channel].Eval(Time)));
+		}
+
+		TestTrue(FString::Printf(TEXT("Channel %d evaluation error is within the allowed error"), Channel), MaxError <= MaxAllowedError);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsBakedCurveFallbackTest, "Als.Utility.BakedCurve.Fallback",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsBakedCurveFallbackTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsBakedCurveTests;
+
+	auto* Curve{MakeFloatCurve()};
+	const auto* OtherCurve{MakeFloatCurve()};
+
+	FAlsBakedCurve BakedCurve;
+	BakedCurve.Bake(Curve);
+
+	// A curve other than the one from which the table was baked is evaluated directly.
+
+	TestFalse(TEXT("Other curve is not baked"), BakedCurve.IsBakedFrom(OtherCurve));
+	TestEqual(TEXT("Other curve is evaluated directly"), BakedCurve.Evaluate(OtherCurve, 0.45f), OtherCurve->GetFloatValue(0.45f));
+
+	// Copies share the baked data.
+
+	const auto BakedCurveCopy{BakedCurve};
+	TestTrue(TEXT("Copy is baked"), BakedCurveCopy.IsBakedFrom(Curve));
+
+	// Cyclic extrapolation can't be represented by the lookup table.
+
+	Curve->FloatCurve.PostInfinityExtrap = RCCE_Cycle;
+	BakedCurve.Bake(Curve);
+
+	TestFalse(TEXT("Cyclic curve is not baked"), BakedCurve.IsBakedFrom(Curve));
+	TestEqual(TEXT("Cyclic curve is evaluated directly"), BakedCurve.Evaluate(Curve, 1.6f), Curve->GetFloatValue(1.6f));
+
+	BakedCurve.Reset();
+	TestEqual(TEXT("Reset curve has no samples"), BakedCurve.GetSamplesCount(), 0);
+
+	// A step can't be represented by linear interpolation between samples with any number of them, so the
+	// maximum number of samples is reached without meeting the maximum allowed error. The step time doesn't
+	// lie on the sample grid.
+
+	auto* StepCurve{NewObject<UCurveFloat>(GetTransientPackage())};
+
+	StepCurve->FloatCurve.AddKey(0.0f, 0.0f);
+	StepCurve->FloatCurve.AddKey(0.3337f, 1.0f);
+	StepCurve->FloatCurve.AddKey(1.0f, 1.0f);
+
+	for (auto Iterator{StepCurve->FloatCurve.GetKeyHandleIterator()}; Iterator; ++Iterator)
+	{
+		StepCurve->FloatCurve.SetKeyInterpMode(*Iterator, RCIM_Constant);
+	}
+
+	// The previously baked data must not be kept either.
+
+	BakedCurve.Bake(OtherCurve);
+	TestTrue(TEXT("Other curve is baked"), BakedCurve.IsBakedFrom(OtherCurve));
+
+	BakedCurve.Bake(StepCurve);
+
+	TestFalse(TEXT("Step curve is not baked"), BakedCurve.IsBakedFrom(StepCurve));
+	TestEqual(TEXT("Step curve has no samples"), BakedCurve.GetSamplesCount(), 0);
+
+	for (const auto Time : {0.3f, 0.33f, 0.3336f, 0.3338f, 0.34f})
+	{
+		TestEqual(FString::Printf(TEXT("Step curve is evaluated directly at %f"), Time),
+		          BakedCurve.Evaluate(StepCurve, Time), StepCurve->GetFloatValue(Time));
+	}
+
+	return true;
+}
+
+#endif
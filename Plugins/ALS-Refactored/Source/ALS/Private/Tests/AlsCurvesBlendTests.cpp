@@ -0,0 +1,123 @@
+#include "Animation/AnimSequence.h"
+#include "Animation/AttributesRuntime.h"
+#include "Misc/AutomationTest.h"
+#include "Nodes/AlsAnimNode_CurvesBlend.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsCurvesBlendTests
+{
+	static constexpr auto EvaluationsCount{50};
+
+	static constexpr auto CurveTolerance{1.0e-6f};
+
+	// Sequences with animation curves from the plugin content, such as the ones that are used as the curves pose.
+	static const TCHAR* CurvesSequenceNames[]
+	{
+		TEXT("/ALS/ALS/Animations/Overlays/Other/A_Als_Default_Poses.A_Als_Default_Poses"),
+		TEXT("/ALS/ALS/Animations/Overlays/Other/A_Als_Masculine_Poses.A_Als_Masculine_Poses"),
+		TEXT("/ALS/ALS/Animations/Overlays/M4/A_Als_M4_Poses.A_Als_M4_Poses"),
+		TEXT("/ALS/ALS/Animations/Grounded/WalkRun/A_Als_Walk_Forward.A_Als_Walk_Forward"),
+		TEXT("/ALS/ALS/Animations/Actions/Roll/A_Als_Roll.A_Als_Roll")
+	};
+
+	static const TCHAR* AdditiveSequenceName{TEXT("/ALS/ALS/Animations/Grounded/Lean/A_Als_Lean_Left.A_Als_Lean_Left")};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsCurvesBlendCurvesOnlyEvaluationTest, "Als.Nodes.CurvesBlend.CurvesOnlyEvaluation",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsCurvesBlendCurvesOnlyEvaluationTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsCurvesBlendTests;
+
+	const auto* AdditiveSequence{LoadObject<UAnimSequence>(nullptr, AdditiveSequenceName)};
+	if (TestNotNull(TEXT("Additive sequence is loaded"), AdditiveSequence))
+	{
+		TestFalse(TEXT("Additive sequence is fully evaluated"), FAlsAnimNode_CurvesBlend::CanEvaluateCurvesOnly(AdditiveSequence));
+	}
+
+	for (const auto* SequenceName : CurvesSequenceNames)
+	{
+		const auto* Sequence{LoadObject<UAnimSequence>(nullptr, SequenceName)};
+
+		if (!TestNotNull(FString::Printf(TEXT("%s is loaded"), SequenceName), Sequence) ||
+		    !TestTrue(FString::Printf(TEXT("%s is evaluated curves only"), SequenceName),
+		              FAlsAnimNode_CurvesBlend::CanEvaluateCurvesOnly(Sequence)))
+		{
+			continue;
+		}
+
+		auto* Skeleton{Sequence->GetSkeleton()};
+		if (!TestNotNull(FString::Printf(TEXT("%s has a skeleton"), SequenceName), Skeleton))
+		{
+			continue;
+		}
+
+		// Require all bones and curves of the skeleton, just like a skeletal mesh at the highest level of detail.
+
+		TArray<FBoneIndexType> RequiredBoneIndices;
+		RequiredBoneIndices.SetNumUninitialized(Skeleton->GetReferenceSkeleton().GetNum());
+
+		for (auto i{0}; i < RequiredBoneIndices.Num(); i++)
+		{
+			RequiredBoneIndices[i] = static_cast<FBoneIndexType>(i);
+		}
+
+		const FBoneContainer BoneContainer{RequiredBoneIndices, FCurveEvaluationOption{true}, *Skeleton};
+
+		FMemMark MemoryMark{FMemStack::Get()};
+
+		auto MaxError{0.0f};
+		auto ComparedCurvesCount{0};
+
+		for (auto i{0}; i <= EvaluationsCount; i++)
+		{
+			const auto Time{Sequence->GetPlayLength() * static_cast<float>(i) / EvaluationsCount};
+
+			// Full evaluation, the same as the sequence player does.
+
+			FCompactPose Pose;
+			Pose.SetBoneContainer(&BoneContainer);
+
+			FBlendedCurve FullCurve;
+			FullCurve.InitFrom(BoneContainer);
+
+			UE::Anim::FStackAttributeContainer Attributes;
+
+			FAnimationPoseData PoseData{Pose, FullCurve, Attributes};
+			Sequence->GetAnimationPose(PoseData, FAnimExtractContext{static_cast<double>(Time)});
+
+			// Curves only evaluation, the same as the curves blend node does.
+
+			FBlendedCurve CurvesOnlyCurve;
+			CurvesOnlyCurve.InitFrom(FullCurve);
+
+			FAlsAnimNode_CurvesBlend::EvaluateCurvesOnly(Sequence, Time, CurvesOnlyCurve);
+
+			const auto* CurveLookupTable{FullCurve.UIDToArrayIndexLUT};
+			if (CurveLookupTable == nullptr)
+			{
+				continue;
+			}
+
+			for (SmartName::UID_Type CurveId{0}; CurveId < CurveLookupTable->Num(); CurveId++)
+			{
+				if (FullCurve.IsEnabled(CurveId))
+				{
+					MaxError = FMath::Max(MaxError, FMath::Abs(FullCurve.Get(CurveId) - CurvesOnlyCurve.Get(CurveId)));
+					ComparedCurvesCount += 1;
+				}
+			}
+		}
+
+		AddInfo(FString::Printf(TEXT("%s: compared curves: %d, maximum error: %g."), SequenceName, ComparedCurvesCount, MaxError));
+
+		TestTrue(FString::Printf(TEXT("%s has curves"), SequenceName), ComparedCurvesCount > 0);
+		TestTrue(FString::Printf(TEXT("%s curves match"), SequenceName), MaxError <= CurveTolerance);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,689 @@
+#include <cmath>
+
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Utility/AlsMath.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsMathTests
+{
+	static constexpr auto InputsCount{100000};
+	static constexpr auto IterationsCount{5};
+	static constexpr auto Seed{0};
+
+	static constexpr auto ForwardHalfAngle{70.0f};
+
+	// Near the counter clockwise rotation angle threshold, the float and the double precision implementations
+	// may legitimately rotate in different directions, so the inputs closer to it than this margin are skipped.
+	static constexpr auto RotationThresholdMargin{0.01};
+
+	// UAlsMath::ExponentialDecay() uses FMath::InvExpApprox(), so its error is measured as a fraction
+	// of the distance between the current and target values and is much larger than the float precision.
+	static constexpr auto MaxExponentialDecayError{0.02};
+
+	static constexpr auto MaxAngleError{1.0e-3};
+	static constexpr auto MaxFastAngleError{2.0e-3};
+	static constexpr auto MaxSpringDampError{1.0e-2};
+	static constexpr auto MaxDirectionError{2.0e-6};
+	static constexpr auto MaxFastDirectionError{2.0e-5};
+
+	struct FInputs
+	{
+		TArray<float> A;
+		TArray<float> B;
+		TArray<float> Alpha;
+		TArray<float> DeltaTime;
+		TArray<float> Speed;
+		TArray<float> Smoothing;
+		TArray<float> Velocity;
+		TArray<FVector2D> Direction;
+		TArray<FRotator> RotationA;
+		TArray<FRotator> RotationB;
+	};
+
+	struct FResult
+	{
+		const TCHAR* KernelName{nullptr};
+
+		double BestTime{0.0};
+
+		double MeanTime{0.0};
+
+		double MaxError{0.0};
+
+		double MeanError{0.0};
+
+		int32 SkippedCount{0};
+	};
+
+	// The reference implementations use the standard library in double precision,
+	// so that they don't depend on the engine math being tested.
+
+	static double NormalizeAngle(const double Angle)
+	{
+		auto Result{std::fmod(Angle + 180.0, 360.0)};
+		if (Result < 0.0)
+		{
+			Result += 360.0;
+		}
+
+		return Result - 180.0;
+	}
+
+	static double AngleError(const double A, const double B)
+	{
+		return std::abs(NormalizeAngle(A - B));
+	}
+
+	static bool IsNearRotationThreshold(const double From, const double To)
+	{
+		return std::abs(NormalizeAngle(To - From) - (180.0 - UAlsMath::CounterClockwiseRotationAngleThreshold)) < RotationThresholdMargin;
+	}
+
+	static double CalculateAngleDelta(const double From, const double To)
+	{
+		auto Delta{NormalizeAngle(To - From)};
+
+		if (Delta > 180.0 - UAlsMath::CounterClockwiseRotationAngleThreshold)
+		{
+			Delta -= 360.0;
+		}
+
+		return Delta;
+	}
+
+	static double LerpAngle(const double A, const double B, const double Alpha)
+	{
+		return NormalizeAngle(A + CalculateAngleDelta(A, B) * Alpha);
+	}
+
+	static double InterpolateAngleConstant(const double Current, const double Target, const double DeltaTime, const double Speed)
+	{
+		const auto Alpha{Speed * DeltaTime};
+
+		return NormalizeAngle(Current + FMath::Clamp(CalculateAngleDelta(Current, Target), -Alpha, Alpha));
+	}
+
+	static EAlsMovementDirection CalculateMovementDirection(const double Angle, const double ForwardHalfAngle, const double AngleThreshold)
+	{
+		if (Angle >= -ForwardHalfAngle - AngleThreshold && Angle <= ForwardHalfAngle + AngleThreshold)
+		{
+			return EAlsMovementDirection::Forward;
+		}
+
+		if (Angle >= ForwardHalfAngle - AngleThreshold && Angle <= 180.0 - ForwardHalfAngle + AngleThreshold)
+		{
+			return EAlsMovementDirection::Right;
+		}
+
+		if (Angle <= -(ForwardHalfAngle - AngleThreshold) && Angle >= -(180.0 - ForwardHalfAngle + AngleThreshold))
+		{
+			return EAlsMovementDirection::Left;
+		}
+
+		return EAlsMovementDirection::Backward;
+	}
+
+	// The inputs depend only on the seed, so the results of different runs can be compared with each other.
+	static const FInputs& GetInputs()
+	{
+		static const auto Inputs{
+			[]
+			{
+				FInputs Result;
+				FRandomStream Random{Seed};
+
+				const auto AddInputs{
+					[](TArray<float>& Values, const TFunctionRef<float()> Generator)
+					{
+						Values.SetNumUninitialized(InputsCount);
+
+						for (auto& Value : Values)
+						{
+							Value = Generator();
+						}
+					}
+				};
+
+				AddInputs(Result.A, [&Random] { return Random.FRandRange(-720.0f, 720.0f); });
+				AddInputs(Result.B, [&Random] { return Random.FRandRange(-720.0f, 720.0f); });
+				AddInputs(Result.Alpha, [&Random] { return Random.FRand(); });
+				AddInputs(Result.DeltaTime, [&Random] { return Random.FRandRange(1.0f / 240.0f, 1.0f / 10.0f); });
+				AddInputs(Result.Speed, [&Random] { return Random.FRandRange(0.1f, 30.0f); });
+				AddInputs(Result.Smoothing, [&Random] { return Random.FRandRange(0.001f, 0.999f); });
+				AddInputs(Result.Velocity, [&Random] { return Random.FRandRange(-1000.0f, 1000.0f); });
+
+				Result.Direction.SetNumUninitialized(InputsCount);
+				Result.RotationA.SetNumUninitialized(InputsCount);
+				Result.RotationB.SetNumUninitialized(InputsCount);
+
+				for (auto i{0}; i < InputsCount; i++)
+				{
+					Result.Direction[i] = {Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f)};
+
+					Result.RotationA[i] = {
+						Random.FRandRange(-180.0f, 180.0f), Random.FRandRange(-180.0f, 180.0f), Random.FRandRange(-180.0f, 180.0f)
+					};
+
+					Result.RotationB[i] = {
+						Random.FRandRange(-180.0f, 180.0f), Random.FRandRange(-180.0f, 180.0f), Random.FRandRange(-180.0f, 180.0f)
+					};
+				}
+
+				return Result;
+			}()
+		};
+
+		return Inputs;
+	}
+
+	// Prepare is called before each iteration and is not included in the measured time.
+	template <typename PrepareType, typename KernelType>
+	static void MeasureTime(PrepareType&& Prepare, KernelType&& Kernel, FResult& Result)
+	{
+		auto BestTime{TNumericLimits<double>::Max()};
+		auto TotalTime{0.0};
+
+		for (auto i{0}; i < IterationsCount; i++)
+		{
+			Prepare();
+
+			const auto StartCycles{FPlatformTime::Cycles64()};
+
+			Kernel();
+
+			const auto Time{FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles)};
+
+			BestTime = FMath::Min(BestTime, Time);
+			TotalTime += Time;
+		}
+
+		// Nanoseconds per call.
+
+		Result.BestTime = BestTime * 1.0e9 / InputsCount;
+		Result.MeanTime = TotalTime * 1.0e9 / (static_cast<double>(InputsCount) * IterationsCount);
+	}
+
+	template <typename KernelType>
+	static void MeasureTime(KernelType&& Kernel, FResult& Result)
+	{
+		MeasureTime([] {}, Forward<KernelType>(Kernel), Result);
+	}
+
+	// The error function returns an unset value for the inputs that must be skipped.
+	template <typename ErrorType>
+	static void MeasureError(ErrorType&& CalculateError, FResult& Result)
+	{
+		auto TotalError{0.0};
+
+		for (auto i{0}; i < InputsCount; i++)
+		{
+			const TOptional<double> Error{CalculateError(i)};
+			if (!Error.IsSet())
+			{
+				Result.SkippedCount += 1;
+				continue;
+			}
+
+			Result.MaxError = FMath::Max(Result.MaxError, Error.GetValue());
+			TotalError += Error.GetValue();
+		}
+
+		Result.MeanError = TotalError / FMath::Max(1, InputsCount - Result.SkippedCount);
+	}
+
+	// Checks the maximum error and appends the result to the machine-readable report.
+	static void FinishResult(FAutomationTestBase& Test, const FResult& Result, const double MaxAllowedError)
+	{
+		Test.AddInfo(FString::Printf(TEXT("%s: best %.3f ns, mean %.3f ns, maximum error %.3e, mean error %.3e, skipped %d."),
+		                             Result.KernelName, Result.BestTime, Result.MeanTime, Result.MaxError, Result.MeanError,
+		                             Result.SkippedCount));
+
+		Test.TestTrue(FString::Printf(TEXT("%s maximum error"), Result.KernelName), Result.MaxError <= MaxAllowedError);
+
+		const auto ReportFilePath{FPaths::ProfilingDir() / TEXT("AlsMathTests.csv")};
+
+		if (!IFileManager::Get().FileExists(*ReportFilePath))
+		{
+			FFileHelper::SaveStringToFile(TEXT("Kernel,Calls,Iterations,Seed,BestNsPerCall,MeanNsPerCall,MaxAbsError,MeanAbsError,")
+			                              TEXT("MaxAllowedError,Skipped\n"), *ReportFilePath);
+		}
+
+		const auto Row{
+			FString::Printf(TEXT("%s,%d,%d,%d,%.4f,%.4f,%.9e,%.9e,%.9e,%d\n"), Result.KernelName, InputsCount, IterationsCount, Seed,
+			                Result.BestTime, Result.MeanTime, Result.MaxError, Result.MeanError, MaxAllowedError, Result.SkippedCount)
+		};
+
+		if (!FFileHelper::SaveStringToFile(Row, *ReportFilePath, FFileHelper::EEncodingOptions::AutoDetect,
+		                                   &IFileManager::Get(), FILEWRITE_Append))
+		{
+			Test.AddWarning(FString::Printf(TEXT("Failed to write the report to %s."), *ReportFilePath));
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMathExponentialDecayTest, "Als.Utility.Math.ExponentialDecay",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMathExponentialDecayTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsMathTests;
+
+	const auto& Inputs{GetInputs()};
+
+	TArray<float> Outputs;
+	Outputs.SetNumUninitialized(InputsCount);
+
+	const auto CalculateAlpha{
+		[&Inputs](const int32 i)
+		{
+			return 1.0 - std::exp(-static_cast<double>(Inputs.Speed[i]) * Inputs.DeltaTime[i]);
+		}
+	};
+
+	{
+		FResult Result{TEXT("ExponentialDecay")};
+
+		MeasureTime([&]
+		{
+			for (auto i{0}; i < InputsCount; i++)
+			{
+				Outputs[i] = UAlsMath::ExponentialDecay(Inputs.DeltaTime[i], Inputs.Speed[i]);
+			}
+		}, Result);
+
+		MeasureError([&](const int32 i) -> TOptional<double>
+		{
+			return std::abs(Outputs[i] - CalculateAlpha(i));
+		}, Result);
+
+		FinishResult(*this, Result, MaxExponentialDecayError);
+	}
+
+	{
+		FResult Result{TEXT("ExponentialDecayValues")};
+
+		MeasureTime([&]
+		{
+			for (auto i{0}; i < InputsCount; i++)
+			{
+				Outputs[i] = UAlsMath::ExponentialDecay(Inputs.A[i], Inputs.B[i], Inputs.DeltaTime[i], Inputs.Speed[i]);
+			}
+		}, Result);
+
+		MeasureError([&](const int32 i) -> TOptional<double>
+		{
+			const auto Distance{static_cast<double>(Inputs.B[i]) - Inputs.A[i]};
+
+			return std::abs(Outputs[i] - (Inputs.A[i] + Distance * CalculateAlpha(i))) / FMath::Max(std::abs(Distance), 1.0);
+		}, Result);
+
+		FinishResult(*this, Result, MaxExponentialDecayError);
+	}
+
+	{
+		FResult Result{TEXT("ExponentialDecayAngle")};
+
+		MeasureTime([&]
+		{
+			for (auto i{0}; i < InputsCount; i++)
+			{
+				Outputs[i] = UAlsMath::ExponentialDecayAngle(Inputs.A[i], Inputs.B[i], Inputs.DeltaTime[i], Inputs.Speed[i]);
+			}
+		}, Result);
+
+		MeasureError([&](const int32 i) -> TOptional<double>
+		{
+			if (IsNearRotationThreshold(Inputs.A[i], Inputs.B[i]))
+			{
+				return {};
+			}
+
+			const auto Distance{CalculateAngleDelta(Inputs.A[i], Inputs.B[i])};
+
+			return AngleError(Outputs[i], LerpAngle(Inputs.A[i], Inputs.B[i], CalculateAlpha(i))) / FMath::Max(std::abs(Distance), 1.0);
+		}, Result);
+
+		FinishResult(*this, Result, MaxExponentialDecayError);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMathDampAngleTest, "Als.Utility.Math.DampAngle",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMathDampAngleTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsMathTests;
+
+	const auto& Inputs{GetInputs()};
+
+	TArray<float> Outputs;
+	Outputs.SetNumUninitialized(InputsCount);
+
+	FResult Result{TEXT("DampAngle")};
+
+	MeasureTime([&]
+	{
+		for (auto i{0}; i < InputsCount; i++)
+		{
+			Outputs[i] = UAlsMath::DampAngle(Inputs.A[i], Inputs.B[i], Inputs.DeltaTime[i], Inputs.Smoothing[i]);
+		}
+	}, Result);
+
+	MeasureError([&](const int32 i) -> TOptional<double>
+	{
+		if (IsNearRotationThreshold(Inputs.A[i], Inputs.B[i]))
+		{
+			return {};
+		}
+
+		const auto Alpha{1.0 - std::pow(static_cast<double>(Inputs.Smoothing[i]), static_cast<double>(Inputs.DeltaTime[i]))};
+
+		return AngleError(Outputs[i], LerpAngle(Inputs.A[i], Inputs.B[i], Alpha));
+	}, Result);
+
+	FinishResult(*this, Result, MaxAngleError);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMathInterpolateAngleConstantTest, "Als.Utility.Math.InterpolateAngleConstant",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMathInterpolateAngleConstantTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsMathTests;
+
+	const auto& Inputs{GetInputs()};
+
+	TArray<float> Outputs;
+	Outputs.SetNumUninitialized(InputsCount);
+
+	FResult Result{TEXT("InterpolateAngleConstant")};
+
+	MeasureTime([&]
+	{
+		for (auto i{0}; i < InputsCount; i++)
+		{
+			Outputs[i] = UAlsMath::InterpolateAngleConstant(Inputs.A[i], Inputs.B[i], Inputs.DeltaTime[i], Inputs.Speed[i]);
+		}
+	}, Result);
+
+	MeasureError([&](const int32 i) -> TOptional<double>
+	{
+		if (IsNearRotationThreshold(Inputs.A[i], Inputs.B[i]))
+		{
+			return {};
+		}
+
+		return AngleError(Outputs[i], InterpolateAngleConstant(Inputs.A[i], Inputs.B[i], Inputs.DeltaTime[i], Inputs.Speed[i]));
+	}, Result);
+
+	FinishResult(*this, Result, MaxAngleError);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMathSpringDampTest, "Als.Utility.Math.SpringDamp",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMathSpringDampTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsMathTests;
+
+	const auto& Inputs{GetInputs()};
+
+	TArray<float> Outputs;
+	Outputs.SetNumUninitialized(InputsCount);
+
+	TArray<FAlsSpringFloatState> SpringStates;
+	SpringStates.SetNum(InputsCount);
+
+	FResult Result{TEXT("SpringDamp")};
+
+	// The spring state is modified by each call, so it is reinitialized from the inputs before each iteration.
+
+	MeasureTime([&]
+	{
+		for (auto i{0}; i < InputsCount; i++)
+		{
+			SpringStates[i].Velocity = Inputs.Velocity[i];
+			SpringStates[i].PreviousTarget = Inputs.A[i];
+			SpringStates[i].bStateValid = true;
+		}
+	}, [&]
+	{
+		for (auto i{0}; i < InputsCount; i++)
+		{
+			Outputs[i] = UAlsMath::SpringDampFloat(Inputs.B[i], Inputs.A[i] + Inputs.Alpha[i] * 10.0f, SpringStates[i],
+			                                       Inputs.DeltaTime[i], Inputs.Speed[i], Inputs.Smoothing[i] * 2.0f);
+		}
+	}, Result);
+
+	MeasureError([&](const int32 i) -> TOptional<double>
+	{
+		const auto Target{static_cast<double>(Inputs.A[i]) + Inputs.Alpha[i] * 10.0};
+		const auto TargetVelocity{(Target - Inputs.A[i]) / Inputs.DeltaTime[i]};
+
+		auto Value{static_cast<double>(Inputs.B[i])};
+		auto Velocity{static_cast<double>(Inputs.Velocity[i])};
+
+		FMath::SpringDamper(Value, Velocity, Target, TargetVelocity, Inputs.DeltaTime[i], Inputs.Speed[i], Inputs.Smoothing[i] * 2.0f);
+
+		return std::abs(Outputs[i] - Value);
+	}, Result);
+
+	FinishResult(*this, Result, MaxSpringDampError);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMathDirectionToAngleTest, "Als.Utility.Math.DirectionToAngle",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMathDirectionToAngleTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsMathTests;
+
+	const auto& Inputs{GetInputs()};
+
+	TArray<double> Outputs;
+	Outputs.SetNumUninitialized(InputsCount);
+
+	const auto CalculateError{
+		[&](const int32 i) -> TOptional<double>
+		{
+			return AngleError(Outputs[i], std::atan2(Inputs.Direction[i].Y, Inputs.Direction[i].X) * (180.0 / UE_DOUBLE_PI));
+		}
+	};
+
+	{
+		FResult Result{TEXT("DirectionToAngleFast")};
+
+		MeasureTime([&]
+		{
+			for (auto i{0}; i < InputsCount; i++)
+			{
+				Outputs[i] = UAlsMath::DirectionToAngle<FAlsFastTrigonometry>(Inputs.Direction[i]);
+			}
+		}, Result);
+
+		MeasureError(CalculateError, Result);
+
+		FinishResult(*this, Result, MaxFastAngleError);
+	}
+
+	{
+		FResult Result{TEXT("DirectionToAngleExact")};
+
+		MeasureTime([&]
+		{
+			for (auto i{0}; i < InputsCount; i++)
+			{
+				Outputs[i] = UAlsMath::DirectionToAngle<FAlsExactTrigonometry>(Inputs.Direction[i]);
+			}
+		}, Result);
+
+		MeasureError(CalculateError, Result);
+
+		FinishResult(*this, Result, MaxAngleError);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMathAngleToDirectionTest, "Als.Utility.Math.AngleToDirection",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMathAngleToDirectionTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsMathTests;
+
+	const auto& Inputs{GetInputs()};
+
+	TArray<FVector2D> Outputs;
+	Outputs.SetNumUninitialized(InputsCount);
+
+	// The reference uses the same float radian as the kernels, so that only the trigonometry error is measured.
+
+	const auto CalculateError{
+		[&](const int32 i) -> TOptional<double>
+		{
+			const auto Radian{static_cast<double>(FMath::DegreesToRadians(Inputs.A[i]))};
+
+			return FMath::Max(std::abs(Outputs[i].X - std::cos(Radian)), std::abs(Outputs[i].Y - std::sin(Radian)));
+		}
+	};
+
+	{
+		FResult Result{TEXT("AngleToDirectionFast")};
+
+		MeasureTime([&]
+		{
+			for (auto i{0}; i < InputsCount; i++)
+			{
+				Outputs[i] = UAlsMath::AngleToDirection<FAlsFastTrigonometry>(Inputs.A[i]);
+			}
+		}, Result);
+
+		MeasureError(CalculateError, Result);
+
+		FinishResult(*this, Result, MaxFastDirectionError);
+	}
+
+	{
+		FResult Result{TEXT("AngleToDirectionExact")};
+
+		MeasureTime([&]
+		{
+			for (auto i{0}; i < InputsCount; i++)
+			{
+				Outputs[i] = UAlsMath::AngleToDirection<FAlsExactTrigonometry>(Inputs.A[i]);
+			}
+		}, Result);
+
+		MeasureError(CalculateError, Result);
+
+		FinishResult(*this, Result, MaxDirectionError);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMathLerpRotatorTest, "Als.Utility.Math.LerpRotator",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMathLerpRotatorTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsMathTests;
+
+	const auto& Inputs{GetInputs()};
+
+	TArray<FRotator> Outputs;
+	Outputs.SetNumUninitialized(InputsCount);
+
+	FResult Result{TEXT("LerpRotator")};
+
+	MeasureTime([&]
+	{
+		for (auto i{0}; i < InputsCount; i++)
+		{
+			Outputs[i] = UAlsMath::LerpRotator(Inputs.RotationA[i], Inputs.RotationB[i], Inputs.Alpha[i]);
+		}
+	}, Result);
+
+	MeasureError([&](const int32 i) -> TOptional<double>
+	{
+		const auto& A{Inputs.RotationA[i]};
+		const auto& B{Inputs.RotationB[i]};
+		const auto& Output{Outputs[i]};
+
+		if (IsNearRotationThreshold(A.Pitch, B.Pitch) || IsNearRotationThreshold(A.Yaw, B.Yaw) ||
+		    IsNearRotationThreshold(A.Roll, B.Roll))
+		{
+			return {};
+		}
+
+		return FMath::Max3(AngleError(Output.Pitch, LerpAngle(A.Pitch, B.Pitch, Inputs.Alpha[i])),
+		                   AngleError(Output.Yaw, LerpAngle(A.Yaw, B.Yaw, Inputs.Alpha[i])),
+		                   AngleError(Output.Roll, LerpAngle(A.Roll, B.Roll, Inputs.Alpha[i])));
+	}, Result);
+
+	FinishResult(*this, Result, MaxAngleError);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsMathCalculateMovementDirectionTest, "Als.Utility.Math.CalculateMovementDirection",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsMathCalculateMovementDirectionTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsMathTests;
+
+	const auto& Inputs{GetInputs()};
+
+	TArray<float> Angles;
+	Angles.SetNumUninitialized(InputsCount);
+
+	TArray<float> AngleThresholds;
+	AngleThresholds.SetNumUninitialized(InputsCount);
+
+	// The angle threshold is taken from the alpha inputs, scaled to the range used by the animation instance. The same
+	// float inputs are passed to the reference implementation, so the directions are expected to match exactly.
+
+	for (auto i{0}; i < InputsCount; i++)
+	{
+		Angles[i] = FRotator3f::NormalizeAxis(Inputs.A[i]);
+		AngleThresholds[i] = Inputs.Alpha[i] * 5.0f;
+	}
+
+	TArray<EAlsMovementDirection> Outputs;
+	Outputs.SetNumUninitialized(InputsCount);
+
+	FResult Result{TEXT("CalculateMovementDirection")};
+
+	MeasureTime([&]
+	{
+		for (auto i{0}; i < InputsCount; i++)
+		{
+			Outputs[i] = UAlsMath::CalculateMovementDirection(Angles[i], ForwardHalfAngle, AngleThresholds[i]);
+		}
+	}, Result);
+
+	MeasureError([&](const int32 i) -> TOptional<double>
+	{
+		return Outputs[i] == CalculateMovementDirection(Angles[i], ForwardHalfAngle, AngleThresholds[i]) ? 0.0 : 1.0;
+	}, Result);
+
+	FinishResult(*this, Result, 0.0);
+
+	return true;
+}
+
+#endif
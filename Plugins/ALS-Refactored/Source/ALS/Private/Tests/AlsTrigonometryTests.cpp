@@ -0,0 +1,82 @@
+#include "Misc/AutomationTest.h"
+#include "Utility/AlsTrigonometry.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsTrigonometryTests
+{
+	static constexpr auto EvaluationsCount{10000};
+
+	static constexpr auto MaxAtan2Error{2.0e-5};
+	static constexpr auto MaxSinCosError{1.0e-5f};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsTrigonometryAtan2Test, "Als.Utility.Trigonometry.Atan2",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsTrigonometryAtan2Test::RunTest(const FString& Parameters)
+{
+	using namespace AlsTrigonometryTests;
+
+	// Signed zeros and axes, where the octant symmetries must match the exact function.
+
+	static constexpr double SpecialValues[]{0.0, -0.0, 1.0, -1.0};
+
+	for (const auto Y : SpecialValues)
+	{
+		for (const auto X : SpecialValues)
+		{
+			TestEqual(FString::Printf(TEXT("Atan2(%g, %g)"), Y, X), FAlsFastTrigonometry::Atan2(Y, X),
+			          FAlsExactTrigonometry::Atan2(Y, X), MaxAtan2Error);
+		}
+	}
+
+	FRandomStream Random{0};
+	auto MaxError{0.0};
+
+	for (auto i{0}; i < EvaluationsCount; i++)
+	{
+		const auto Y{static_cast<double>(Random.FRandRange(-1.0f, 1.0f))};
+		const auto X{static_cast<double>(Random.FRandRange(-1.0f, 1.0f))};
+
+		MaxError = FMath::Max(MaxError, FMath::Abs(FAlsFastTrigonometry::Atan2(Y, X) - FAlsExactTrigonometry::Atan2(Y, X)));
+	}
+
+	AddInfo(FString::Printf(TEXT("Maximum Atan2() error: %g radians."), MaxError));
+
+	TestTrue(TEXT("Maximum Atan2() error"), MaxError <= MaxAtan2Error);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsTrigonometrySinCosTest, "Als.Utility.Trigonometry.SinCos",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsTrigonometrySinCosTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsTrigonometryTests;
+
+	FRandomStream Random{0};
+	auto MaxError{0.0f};
+
+	for (auto i{0}; i < EvaluationsCount; i++)
+	{
+		const auto Radian{Random.FRandRange(-4.0f * UE_PI, 4.0f * UE_PI)};
+
+		float FastSin, FastCos;
+		FAlsFastTrigonometry::SinCos(FastSin, FastCos, Radian);
+
+		float ExactSin, ExactCos;
+		FAlsExactTrigonometry::SinCos(ExactSin, ExactCos, Radian);
+
+		MaxError = FMath::Max3(MaxError, FMath::Abs(FastSin - ExactSin), FMath::Abs(FastCos - ExactCos));
+	}
+
+	AddInfo(FString::Printf(TEXT("Maximum SinCos() error: %g."), MaxError));
+
+	TestTrue(TEXT("Maximum SinCos() error"), MaxError <= MaxSinCosError);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,197 @@
+#include "Animation/AnimTypes.h"
+#include "Misc/AutomationTest.h"
+#include "State/AlsViewState.h"
+#include "Utility/AlsMath.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsViewNetworkSmoothingTests
+{
+	static constexpr auto FrameDeltaTime{1.0f / 60.0f};
+	static constexpr auto Duration{10.0f};
+	static constexpr auto WarmUpTime{0.5f};
+	static constexpr auto MaxExtrapolationTime{0.1f};
+
+	// Same as the default AGameNetworkManager::MaxClientSmoothingDeltaTime
+	// and UCharacterMovementComponent::NetworkSimulatedSmoothLocationTime.
+	static constexpr auto MaxServerDeltaTime{0.5f};
+	static constexpr auto MinServerDeltaTime{0.1f};
+
+	// The recorded view yaw angle: an irregular turn, a full stop, and then a constant turn.
+	static FRotator CalculateViewRotation(const float Time)
+	{
+		static constexpr auto StopTime{4.0f};
+		static constexpr auto ConstantTurnTime{6.0f};
+
+		const auto CalculateIrregularYaw{
+			[](const float IrregularTime)
+			{
+				return 90.0f * FMath::Sin(1.3f * IrregularTime) + 30.0f * FMath::Sin(3.7f * IrregularTime);
+			}
+		};
+
+		auto Yaw{CalculateIrregularYaw(FMath::Min(Time, StopTime))};
+
+		if (Time > ConstantTurnTime)
+		{
+			Yaw += 60.0f * (Time - ConstantTurnTime);
+		}
+
+		return FRotator{0.0f, FRotator3f::NormalizeAxis(Yaw), 0.0f};
+	}
+
+	struct FResult
+	{
+		float MaxError{0.0f};
+
+		float MeanError{0.0f};
+	};
+
+	// Replays the recorded view rotation, received at the given rate without latency, through the linear network smoothing of
+	// AAlsCharacter::RefreshViewNetworkSmoothing() or through the smoothing buffer. The error of each frame is measured against
+	// the recorded view rotation at the client time, i.e. the server time that the smoothed view rotation represents.
+	static FResult Replay(const float UpdateRate, const bool bUseBuffer)
+	{
+		FAlsViewNetworkSmoothingState NetworkSmoothing;
+		NetworkSmoothing.Rotation = CalculateViewRotation(0.0f);
+
+		auto RawViewRotation{NetworkSmoothing.Rotation};
+		auto NextServerTime{1.0f / UpdateRate};
+
+		FResult Result;
+		auto ErrorsCount{0};
+
+		for (auto Time{FrameDeltaTime}; Time < Duration; Time += FrameDeltaTime)
+		{
+			while (NextServerTime <= Time)
+			{
+				// Same as AAlsCharacter::CorrectViewNetworkSmoothing().
+
+				RawViewRotation = CalculateViewRotation(NextServerTime);
+
+				NetworkSmoothing.InitialRotation = NetworkSmoothing.Rotation;
+
+				if (bUseBuffer)
+				{
+					NetworkSmoothing.Buffer.AddSample(NextServerTime, RawViewRotation);
+				}
+
+				const auto ServerDeltaTime{NextServerTime - NetworkSmoothing.ServerTime};
+				NetworkSmoothing.ServerTime = NextServerTime;
+
+				const auto MinClientDeltaTime{FMath::Clamp(ServerDeltaTime * 1.25f, MinServerDeltaTime, MaxServerDeltaTime)};
+
+				NetworkSmoothing.ClientTime = FMath::Clamp(NetworkSmoothing.ClientTime,
+				                                           NetworkSmoothing.ServerTime - MinClientDeltaTime,
+				                                           NetworkSmoothing.ServerTime);
+
+				NetworkSmoothing.Duration = NetworkSmoothing.ServerTime - NetworkSmoothing.ClientTime;
+
+				NextServerTime += 1.0f / UpdateRate;
+			}
+
+			// Same as AAlsCharacter::RefreshViewNetworkSmoothing().
+
+			if (bUseBuffer && NetworkSmoothing.Buffer.SamplesCount > 0)
+			{
+				NetworkSmoothing.ClientTime = FMath::Min(NetworkSmoothing.ClientTime + FrameDeltaTime,
+				                                         NetworkSmoothing.Buffer.GetEndServerTime(MaxExtrapolationTime));
+
+				NetworkSmoothing.Rotation = NetworkSmoothing.Buffer.Evaluate(NetworkSmoothing.ClientTime, MaxExtrapolationTime);
+			}
+			else if (NetworkSmoothing.ClientTime >= NetworkSmoothing.ServerTime || NetworkSmoothing.Duration <= SMALL_NUMBER)
+			{
+				NetworkSmoothing.InitialRotation = RawViewRotation;
+				NetworkSmoothing.Rotation = RawViewRotation;
+			}
+			else
+			{
+				NetworkSmoothing.ClientTime += FrameDeltaTime;
+
+				const auto InterpolationAmount{
+					UAlsMath::Clamp01(1.0f - (NetworkSmoothing.ServerTime - NetworkSmoothing.ClientTime) / NetworkSmoothing.Duration)
+				};
+
+				if (!FAnimWeight::IsFullWeight(InterpolationAmount))
+				{
+					NetworkSmoothing.Rotation = UAlsMath::LerpRotator(NetworkSmoothing.InitialRotation, RawViewRotation,
+					                                                  InterpolationAmount);
+				}
+				else
+				{
+					NetworkSmoothing.ClientTime = NetworkSmoothing.ServerTime;
+					NetworkSmoothing.Rotation = RawViewRotation;
+				}
+			}
+
+			if (Time >= WarmUpTime)
+			{
+				const auto Error{
+					FMath::Abs(FRotator3f::NormalizeAxis(UE_REAL_TO_FLOAT(NetworkSmoothing.Rotation.Yaw) -
+					                                     UE_REAL_TO_FLOAT(CalculateViewRotation(NetworkSmoothing.ClientTime).Yaw)))
+				};
+
+				Result.MaxError = FMath::Max(Result.MaxError, Error);
+				Result.MeanError += Error;
+				ErrorsCount += 1;
+			}
+		}
+
+		Result.MeanError /= ErrorsCount;
+
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsViewNetworkSmoothingComparisonTest, "Als.State.ViewNetworkSmoothing.Comparison",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsViewNetworkSmoothingComparisonTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsViewNetworkSmoothingTests;
+
+	for (const auto UpdateRate : {30.0f, 10.0f})
+	{
+		const auto LinearResult{Replay(UpdateRate, false)};
+		const auto BufferResult{Replay(UpdateRate, true)};
+
+		AddInfo(FString::Printf(TEXT("%.0f Hz: linear max error %.4f, mean error %.4f; buffer max error %.4f, mean error %.4f."),
+		                        UpdateRate, LinearResult.MaxError, LinearResult.MeanError,
+		                        BufferResult.MaxError, BufferResult.MeanError));
+
+		TestTrue(FString::Printf(TEXT("Buffer mean error is not larger than linear mean error at %.0f Hz"), UpdateRate),
+		         BufferResult.MeanError <= LinearResult.MeanError);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsViewNetworkSmoothingExtrapolationTest, "Als.State.ViewNetworkSmoothing.Extrapolation",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAlsViewNetworkSmoothingExtrapolationTest::RunTest(const FString& Parameters)
+{
+	using namespace AlsViewNetworkSmoothingTests;
+
+	// The view turns at a constant speed and then stops, so no new samples are received after the last one.
+
+	FAlsViewNetworkSmoothingBuffer Buffer;
+	Buffer.AddSample(1.0f, {0.0f, 10.0f, 0.0f});
+	Buffer.AddSample(1.1f, {0.0f, 20.0f, 0.0f});
+
+	const auto ExtrapolatedRotation{Buffer.Evaluate(1.1f + MaxExtrapolationTime, MaxExtrapolationTime)};
+
+	TestEqual(TEXT("Rotation is extrapolated"), UE_REAL_TO_FLOAT(ExtrapolatedRotation.Yaw), 30.0f, 0.01f);
+
+	const auto EndServerTime{Buffer.GetEndServerTime(MaxExtrapolationTime)};
+
+	TestEqual(TEXT("Rotation returns to the last one"),
+	          UE_REAL_TO_FLOAT(Buffer.Evaluate(EndServerTime, MaxExtrapolationTime).Yaw), 20.0f, 0.01f);
+
+	TestEqual(TEXT("Rotation stays at the last one"),
+	          UE_REAL_TO_FLOAT(Buffer.Evaluate(EndServerTime + 1.0f, MaxExtrapolationTime).Yaw), 20.0f, 0.01f);
+
+	return true;
+}
+
+#endif
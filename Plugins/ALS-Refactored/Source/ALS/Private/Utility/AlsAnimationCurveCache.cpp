@@ -0,0 +1,41 @@
+#include "Utility/AlsAnimationCurveCache.h"
+
+#include "Animation/AnimInstance.h"
+#include "Utility/AlsTrace.h"
+
+void FAlsAnimationCurveCache::Initialize(const TConstArrayView<FName> NewCurveNames)
+{
+	CurveNames.Reset(NewCurveNames.Num());
+	CurveNames.Append(NewCurveNames.GetData(), NewCurveNames.Num());
+
+	CurveNameHashes.Reset(CurveNames.Num());
+
+	for (const auto& CurveName : CurveNames)
+	{
+		CurveNameHashes.Add(GetTypeHash(CurveName));
+	}
+
+	CurveValues.Init(0.0f, CurveNames.Num());
+}
+
+void FAlsAnimationCurveCache::Refresh(const UAnimInstance* AnimationInstance)
+{
+	ALS_TRACE_SCOPE(FAlsAnimationCurveCache_Refresh)
+
+	const auto& Curves{AnimationInstance->GetAnimationCurveList(EAnimCurveType::AttributeCurve)};
+
+	if (Curves.IsEmpty())
+	{
+		FMemory::Memzero(CurveValues.GetData(), CurveValues.Num() * sizeof(float));
+		return;
+	}
+
+	for (auto i{0}; i < CurveNames.Num(); i++)
+	{
+		const auto* CurveValue{Curves.FindByHash(CurveNameHashes[i], CurveNames[i])};
+
+		CurveValues[i] = CurveValue != nullptr ? *CurveValue : 0.0f;
+	}
+
+	ALS_TRACE_COUNTER_ADD(AnimationCurveReads, CurveNames.Num());
+}
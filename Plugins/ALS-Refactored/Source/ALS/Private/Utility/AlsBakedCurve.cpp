@@ -0,0 +1,181 @@
+#include "Utility/AlsBakedCurve.h"
+
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+#include "Utility/AlsLog.h"
+
+namespace AlsBakedCurveConstants
+{
+	static constexpr auto InitialSamplesCount{17};
+}
+
+void FAlsBakedCurve::Bake(const UCurveFloat* Curve, const int32 MaxSamplesCount, const float MaxRelativeError)
+{
+	if (!IsValid(Curve))
+	{
+		Reset();
+		return;
+	}
+
+	const FRichCurve* ChannelCurves[]{&Curve->FloatCurve};
+
+	Bake(Curve, ChannelCurves, MaxSamplesCount, MaxRelativeError);
+}
+
+void FAlsBakedCurve::Bake(const UCurveVector* Curve, const int32 MaxSamplesCount, const float MaxRelativeError)
+{
+	if (!IsValid(Curve))
+	{
+		Reset();
+		return;
+	}
+
+	const FRichCurve* ChannelCurves[]{&Curve->FloatCurves[0], &Curve->FloatCurves[1], &Curve->FloatCurves[2]};
+
+	Bake(Curve, ChannelCurves, MaxSamplesCount, MaxRelativeError);
+}
+
+void FAlsBakedCurve::Bake(const UCurveBase* Curve, const TConstArrayView<const FRichCurve*> ChannelCurves,
+                          const int32 MaxSamplesCount, const float MaxRelativeError)
+{
+	Reset();
+
+	auto MinTime{TNumericLimits<float>::Max()};
+	auto MaxTime{TNumericLimits<float>::Lowest()};
+
+	for (const auto* ChannelCurve : ChannelCurves)
+	{
+		// Only constant extrapolation can be represented by clamping the lookup table.
+
+		if (ChannelCurve->GetNumKeys() > 1 &&
+		    (ChannelCurve->PreInfinityExtrap != RCCE_Constant || ChannelCurve->PostInfinityExtrap != RCCE_Constant))
+		{
+			UE_LOG(LogAls, Verbose, TEXT("%s: curve %s uses non-constant extrapolation and will not be baked."),
+			       ANSI_TO_TCHAR(__FUNCTION__), *Curve->GetName());
+			return;
+		}
+
+		if (ChannelCurve->GetNumKeys() > 0)
+		{
+			float ChannelMinTime, ChannelMaxTime;
+			ChannelCurve->GetTimeRange(ChannelMinTime, ChannelMaxTime);
+
+			MinTime = FMath::Min(MinTime, ChannelMinTime);
+			MaxTime = FMath::Max(MaxTime, ChannelMaxTime);
+		}
+	}
+
+	if (MinTime > MaxTime)
+	{
+		// All channels are empty.
+
+		MinTime = 0.0f;
+		MaxTime = 0.0f;
+	}
+
+	const auto ChannelsCount{ChannelCurves.Num()};
+
+	// The maximum allowed error of each channel is relative to its value range.
+
+	TArray<float, TInlineAllocator<3>> ChannelsMaxError;
+	ChannelsMaxError.Reserve(ChannelsCount);
+
+	for (const auto* ChannelCurve : ChannelCurves)
+	{
+		float MinValue, MaxValue;
+		ChannelCurve->GetValueRange(MinValue, MaxValue);
+
+		ChannelsMaxError.Add(FMath::Max(MaxValue - MinValue, 1.0f) * MaxRelativeError);
+	}
+
+	// The new data is fully built before it is published, because it may be read by worker threads right after that.
+
+	auto NewData{MakeShared<FData, ESPMode::ThreadSafe>()};
+
+	NewData->SourceCurve = FObjectKey{Curve};
+	NewData->ChannelsCount = ChannelsCount;
+	NewData->MinTime = MinTime;
+
+	auto SamplesCount{AlsBakedCurveConstants::InitialSamplesCount};
+
+	while (true)
+	{
+		const auto SampleInterval{FMath::Max(MaxTime - MinTime, UE_KINDA_SMALL_NUMBER) / (SamplesCount - 1)};
+
+		NewData->SamplesCount = SamplesCount;
+		NewData->InverseSampleInterval = 1.0f / SampleInterval;
+
+		NewData->Samples.SetNumUninitialized(SamplesCount * ChannelsCount);
+
+		for (auto i{0}; i < SamplesCount; i++)
+		{
+			for (auto j{0}; j < ChannelsCount; j++)
+			{
+				NewData->Samples[i * ChannelsCount + j] = ChannelCurves[j]->Eval(MinTime + SampleInterval * i);
+			}
+		}
+
+		// Measure the error in the middle between the samples, where it is usually the largest.
+
+		auto bErrorAllowed{true};
+		NewData->MaxError = 0.0f;
+
+		for (auto i{0}; i < SamplesCount - 1; i++)
+		{
+			const auto Time{MinTime + SampleInterval * (i + 0.5f)};
+
+			for (auto j{0}; j < ChannelsCount; j++)
+			{
+				const auto Error{FMath::Abs(EvaluateBaked(*NewData, j, Time) - ChannelCurves[j]->Eval(Time))};
+
+				NewData->MaxError = FMath::Max(NewData->MaxError, Error);
+				bErrorAllowed &= Error <= ChannelsMaxError[j];
+			}
+		}
+
+		if (bErrorAllowed)
+		{
+			break;
+		}
+
+		if (SamplesCount >= MaxSamplesCount)
+		{
+			// Publishing the table would silently exceed the maximum allowed error, so the curve itself is evaluated instead.
+
+			UE_LOG(LogAls, Verbose, TEXT("%s: curve %s exceeds the maximum allowed error with %d samples and will not be baked."),
+			       ANSI_TO_TCHAR(__FUNCTION__), *Curve->GetName(), SamplesCount);
+			return;
+		}
+
+		// Doubling the number of intervals keeps all existing samples in place.
+
+		SamplesCount = FMath::Min((SamplesCount - 1) * 2 + 1, FMath::Max(MaxSamplesCount, 2));
+	}
+
+	PublishedData.Add(NewData);
+	Data.store(&NewData.Get(), std::memory_order_release);
+
+	UE_LOG(LogAls, VeryVerbose, TEXT("%s: curve %s baked into %d samples with the maximum error of %f."),
+	       ANSI_TO_TCHAR(__FUNCTION__), *Curve->GetName(), NewData->SamplesCount, NewData->MaxError);
+}
+
+float FAlsBakedCurve::Evaluate(const UCurveFloat* Curve, const float Time) const
+{
+	const auto* BakedData{GetDataBakedFrom(Curve)};
+	return BakedData != nullptr ? EvaluateBaked(*BakedData, 0, Time) : Curve->GetFloatValue(Time);
+}
+
+float FAlsBakedCurve::Evaluate(const UCurveVector* Curve, const int32 Channel, const float Time) const
+{
+	const auto* BakedData{GetDataBakedFrom(Curve)};
+	return BakedData != nullptr ? EvaluateBaked(*BakedData, Channel, Time) : Curve->FloatCurves[Channel].Eval(Time);
+}
+
+FVector FAlsBakedCurve::Evaluate(const UCurveVector* Curve, const float Time) const
+{
+	const auto* BakedData{GetDataBakedFrom(Curve)};
+
+	return BakedData != nullptr
+		       ? FVector{EvaluateBaked(*BakedData, 0, Time), EvaluateBaked(*BakedData, 1, Time), EvaluateBaked(*BakedData, 2, Time)}
+		       : Curve->GetVectorValue(Time);
+}
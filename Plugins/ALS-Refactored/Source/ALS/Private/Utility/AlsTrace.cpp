@@ -0,0 +1,47 @@
+﻿#include "Utility/AlsTrace.h"
+
+#if ALS_TRACE_ENABLED
+
+#include "GameplayTagContainer.h"
+#include "Engine/NetConnection.h"
+#include "GameFramework/Actor.h"
+#include "Misc/MiscTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(AlsChannel)
+
+CSV_DEFINE_CATEGORY_MODULE(ALS_API, Als, false);
+
+bool AlsTrace::IsEnabled()
+{
+#if CSV_PROFILER
+	if (FCsvProfiler::Get()->IsCapturing())
+	{
+		return true;
+	}
+#endif
+
+	return UE_TRACE_CHANNELEXPR_IS_ENABLED(AlsChannel);
+}
+
+UPackageMap* AlsTrace::GetPackageMap(const AActor* Actor)
+{
+	const auto* NetConnection{IsValid(Actor) ? Actor->GetNetConnection() : nullptr};
+	return NetConnection != nullptr ? NetConnection->PackageMap : nullptr;
+}
+
+void AlsTrace::TraceStateTransition(const AActor* Actor, const TCHAR* StateName,
+                                    const FGameplayTag& PreviousTag, const FGameplayTag& NewTag)
+{
+	const auto ActorName{GetNameSafe(Actor)};
+	const auto PreviousTagName{PreviousTag.GetTagName().ToString()};
+	const auto NewTagName{NewTag.GetTagName().ToString()};
+
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(AlsChannel))
+	{
+		TRACE_BOOKMARK(TEXT("Als: %s %s: %s -> %s"), *ActorName, StateName, *PreviousTagName, *NewTagName);
+	}
+
+	CSV_EVENT(Als, TEXT("%s %s: %s -> %s"), *ActorName, StateName, *PreviousTagName, *NewTagName);
+}
+
+#endif
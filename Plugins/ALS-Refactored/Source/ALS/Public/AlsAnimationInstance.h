@@ -2,6 +2,7 @@
 
 #include "GameplayTagContainer.h"
 #include "Animation/AnimInstance.h"
+#include "State/AlsCompiledState.h"
 #include "State/AlsFeetState.h"
 #include "State/AlsGroundedState.h"
 #include "State/AlsInAirState.h"
@@ -14,17 +15,65 @@
 #include "State/AlsTransitionsState.h"
 #include "State/AlsTurnInPlaceState.h"
 #include "State/AlsViewAnimationState.h"
+#include "Utility/AlsAnimationCurveCache.h"
 #include "Utility/AlsGameplayTags.h"
 #include "AlsAnimationInstance.generated.h"
 
 class UAlsAnimationInstanceSettings;
 class AAlsCharacter;
+struct FAlsAnimationInstanceProxy;
+
+// Animation curves that are read by the animation instance on every update.
+enum class EAlsAnimationCurve : uint8
+{
+	LayerHead,
+	LayerHeadAdditive,
+	LayerHeadSlot,
+	LayerArmLeft,
+	LayerArmLeftAdditive,
+	LayerArmLeftSlot,
+	LayerArmLeftLocalSpace,
+	LayerArmRight,
+	LayerArmRightAdditive,
+	LayerArmRightSlot,
+	LayerArmRightLocalSpace,
+	LayerHandLeft,
+	LayerHandRight,
+	LayerSpine,
+	LayerSpineAdditive,
+	LayerSpineSlot,
+	LayerPelvis,
+	LayerPelvisSlot,
+	LayerLegs,
+	LayerLegsSlot,
+	PoseGrounded,
+	PoseInAir,
+	PoseStanding,
+	PoseCrouching,
+	PoseMoving,
+	PoseGait,
+	ViewBlock,
+	AllowAiming,
+	SprintBlock,
+	HipsDirectionLock,
+	GroundPredictionBlock,
+	FootLeftIk,
+	FootLeftLock,
+	FootRightIk,
+	FootRightLock,
+	FootPlanted,
+	FeetCrossing,
+	AllowTransitions,
+	Count
+};
 
 UCLASS()
 class ALS_API UAlsAnimationInstance : public UAnimInstance
 {
 	GENERATED_BODY()
 
+	friend FAlsAnimationInstanceProxy;
+
 protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	TObjectPtr<UAlsAnimationInstanceSettings> Settings;
@@ -40,6 +89,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	bool bTeleported;
 
+	FAlsAnimationCurveCache CurveCache;
+
+	FAlsCompiledState CompiledState;
+
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	bool bDisplayDebugTraces;
@@ -119,6 +172,11 @@ public:
 
 	virtual void NativePostEvaluateAnimation() override;
 
+protected:
+	virtual FAnimInstanceProxy* CreateAnimInstanceProxy() override;
+
+	virtual void DestroyAnimInstanceProxy(FAnimInstanceProxy* Proxy) override;
+
 	// Core
 
 protected:
@@ -224,16 +282,20 @@ private:
 private:
 	void RefreshFeetGameThread();
 
+	void RefreshFootIkTraceGameThread(FAlsFootState& FootState);
+
 	void RefreshFeet(float DeltaTime);
 
-	void RefreshFoot(FAlsFootState& FootState, const FName& FootIkCurveName, const FName& FootLockCurveName,
+	void RefreshFeetTargets();
+
+	void RefreshFoot(FAlsFootState& FootState, EAlsAnimationCurve FootIkCurve, EAlsAnimationCurve FootLockCurve,
 	                 const FTransform& ComponentTransformInverse, float DeltaTime) const;
 
 	void ProcessFootLockTeleport(FAlsFootState& FootState) const;
 
 	void ProcessFootLockBaseChange(FAlsFootState& FootState, const FTransform& ComponentTransformInverse) const;
 
-	void RefreshFootLock(FAlsFootState& FootState, const FName& FootLockCurveName, const FTransform& ComponentTransformInverse,
+	void RefreshFootLock(FAlsFootState& FootState, EAlsAnimationCurve FootLockCurve, const FTransform& ComponentTransformInverse,
 	                     float DeltaTime, FVector& FinalLocation, FQuat& FinalRotation) const;
 
 	void RefreshFootOffset(FAlsFootState& FootState, float DeltaTime, FVector& FinalLocation, FQuat& FinalRotation) const;
@@ -300,6 +362,10 @@ public:
 
 public:
 	float GetCurveValueClamped01(const FName& CurveName) const;
+
+	float GetCachedCurveValue(EAlsAnimationCurve Curve) const;
+
+	float GetCachedCurveValueClamped01(EAlsAnimationCurve Curve) const;
 };
 
 inline UAlsAnimationInstanceSettings* UAlsAnimationInstance::GetSettingsUnsafe() const
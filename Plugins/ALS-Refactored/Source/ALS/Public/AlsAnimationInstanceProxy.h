@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Animation/AnimInstanceProxy.h"
+#include "AlsAnimationInstanceProxy.generated.h"
+
+class USkeleton;
+
+// Keeps the component space transforms of the foot target bones from the last evaluated pose, so that the
+// animation instance can read them on a worker thread without accessing the skeletal mesh component.
+USTRUCT()
+struct ALS_API FAlsAnimationInstanceProxy : public FAnimInstanceProxy
+{
+	GENERATED_BODY()
+
+protected:
+	bool bUseFootIkBones{false};
+
+	// Skeleton and settings for which the foot target bone indices were resolved.
+	TWeakObjectPtr<const USkeleton> FootTargetBonesSkeleton;
+
+	bool bFootTargetBonesUseIkBones{false};
+
+	int32 FootTargetSkeletonBoneIndices[2]{INDEX_NONE, INDEX_NONE};
+
+	// Identity if the foot target bone is not found, so that the foot target falls back to the component transform.
+	FTransform FootTargetTransforms[2]{FTransform::Identity, FTransform::Identity};
+
+public:
+	FAlsAnimationInstanceProxy() = default;
+
+	explicit FAlsAnimationInstanceProxy(UAnimInstance* AnimationInstance);
+
+	const FTransform& GetFootTargetTransform(int32 FootIndex) const;
+
+protected:
+	virtual void PreUpdate(UAnimInstance* AnimationInstance, float DeltaTime) override;
+
+	virtual bool Evaluate(FPoseContext& Output) override;
+
+private:
+	void RefreshFootTargetTransforms(const FCompactPose& Pose);
+};
+
+inline FAlsAnimationInstanceProxy::FAlsAnimationInstanceProxy(UAnimInstance* AnimationInstance)
+	: FAnimInstanceProxy{AnimationInstance} {}
+
+inline const FTransform& FAlsAnimationInstanceProxy::GetFootTargetTransform(const int32 FootIndex) const
+{
+	return FootTargetTransforms[FootIndex <= 0 ? 0 : 1];
+}
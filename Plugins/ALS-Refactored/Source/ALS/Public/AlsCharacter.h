@@ -3,9 +3,15 @@
 #include "GameplayTagContainer.h"
 #include "GameFramework/Character.h"
 #include "Settings/AlsMantlingSettings.h"
+#include "State/AlsActionEventsState.h"
+#include "State/AlsCompiledState.h"
+#include "State/AlsDesiredState.h"
 #include "State/AlsLocomotionState.h"
+#include "State/AlsMantlingState.h"
 #include "State/AlsRagdollingState.h"
+#include "State/AlsRagdollSnapshot.h"
 #include "State/AlsRollingState.h"
+#include "State/AlsSignificanceState.h"
 #include "State/AlsViewState.h"
 #include "Utility/AlsGameplayTags.h"
 #include "AlsCharacter.generated.h"
@@ -14,12 +20,15 @@ class UAlsCharacterMovementComponent;
 class UAlsCharacterSettings;
 class UAlsMovementSettings;
 class UAlsAnimationInstance;
+class UAlsLocomotionBatchSubsystem;
 
 UCLASS(AutoExpandCategories = ("Settings|Als Character", "Settings|Als Character|Desired State", "State|Als Character"))
 class ALS_API AAlsCharacter : public ACharacter
 {
 	GENERATED_BODY()
 
+	friend UAlsLocomotionBatchSubsystem;
+
 protected:
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Als Character")
 	TObjectPtr<UAlsCharacterMovementComponent> AlsCharacterMovement;
@@ -30,26 +39,30 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Settings|Als Character")
 	TObjectPtr<UAlsMovementSettings> MovementSettings;
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State",
-		ReplicatedUsing = "OnReplicated_DesiredAiming")
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State")
 	bool bDesiredAiming;
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State", Replicated)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State")
 	FGameplayTag DesiredRotationMode{AlsRotationModeTags::LookingDirection};
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State", Replicated)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State")
 	FGameplayTag DesiredStance{AlsStanceTags::Standing};
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State", Replicated)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State")
 	FGameplayTag DesiredGait{AlsGaitTags::Running};
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State", Replicated)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State")
 	FGameplayTag ViewMode{AlsViewModeTags::ThirdPerson};
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State",
-		ReplicatedUsing = "OnReplicated_OverlayMode")
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State")
 	FGameplayTag OverlayMode{AlsOverlayModeTags::Default};
 
+	// Packed copy of the desired state properties above, replicated as a single property
+	// instead of them. Must be refreshed every time one of the desired state properties changes.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
+		ReplicatedUsing = "OnReplicated_DesiredState")
+	FAlsDesiredState DesiredState;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	bool bSimulatedProxyTeleported;
 
@@ -88,17 +101,62 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	int32 MantlingRootMotionSourceId;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
+	FAlsMantlingState MantlingState;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, Replicated)
 	FVector_NetQuantize100 RagdollTargetLocation;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, Replicated)
+	FAlsRagdollSnapshot RagdollSnapshot;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsRagdollingState RagdollingState;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsRollingState RollingState;
 
+	FCriticalSection RagdollingAsyncStateLock;
+
+	FAlsRagdollingAsyncState RagdollingAsyncState;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
+	FAlsSignificanceState SignificanceState;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
+		ReplicatedUsing = "OnReplicated_ActionEvents")
+	FAlsActionEventsState ActionEvents;
+
+	// Compiled copy of the state tags above, used by the native code instead of gameplay tag comparisons.
+	FAlsCompiledState CompiledState;
+
 	FTimerHandle BrakingFrictionFactorResetTimer;
 
+	// Number of the last frame in which the view and locomotion were refreshed by the locomotion batch subsystem.
+	uint64 BatchedRefreshFrameNumber{0};
+
+	// Used by the autonomous proxy to send all desired state changes made during a frame in a single server RPC.
+	bool bDesiredStateSendPending{false};
+
+	// Time, view rotation and input direction of the last update sent to the server or marked
+	// for replication to simulated proxies. Used only when the compressed view replication is enabled.
+	float CompressedReplicationTime{0.0f};
+
+	FRotator CompressedReplicationViewRotation{ForceInit};
+
+	FVector CompressedReplicationInputDirection{ForceInit};
+
+	// Time at which the view rotation or input direction last changed, and their values at that time. Used
+	// to send the final values once they stop changing. Used only when the compressed view replication is enabled.
+	float CompressedReplicationChangeTime{0.0f};
+
+	FRotator CompressedReplicationPreviousViewRotation{ForceInit};
+
+	FVector CompressedReplicationPreviousInputDirection{ForceInit};
+
+	// Sequence number of the last action event processed on this machine.
+	uint8 ProcessedActionEventSequenceNumber{0};
+
 public:
 	AAlsCharacter(const FObjectInitializer& Initializer = FObjectInitializer::Get());
 
@@ -115,6 +173,8 @@ public:
 protected:
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
 public:
 	virtual void PostNetReceiveLocationAndRotation() override;
 
@@ -122,16 +182,74 @@ public:
 
 	virtual void Tick(float DeltaTime) override;
 
+	virtual void AsyncPhysicsTickActor(float DeltaTime, float SimTime) override;
+
 	virtual void PossessedBy(AController* NewController) override;
 
+	virtual void UnPossessed() override;
+
+	virtual void OnRep_Controller() override;
+
 	virtual void Restart() override;
 
 private:
-	void RefreshVisibilityBasedAnimTickOption() const;
+	bool ShouldRefreshFullTick(float PendingDeltaTime) const;
+
+	void RefreshFullTick(float DeltaTime, bool bViewAndLocomotionRefreshed);
+
+	void RefreshSkippedTick(float DeltaTime);
 
 public:
+	const UAlsCharacterSettings* GetSettings() const;
+
 	bool IsSimulatedProxyTeleported() const;
 
+	// Compiled State
+
+public:
+	const FAlsCompiledState& GetCompiledState() const;
+
+private:
+	void RefreshCompiledState();
+
+	// Desired State
+
+public:
+	const FAlsDesiredState& GetDesiredState() const;
+
+private:
+	void RefreshDesiredState();
+
+	void TrySendDesiredState();
+
+	UFUNCTION(Server, Reliable)
+	void ServerSetDesiredState(const FAlsDesiredState& NewState);
+
+	UFUNCTION()
+	void OnReplicated_DesiredState(const FAlsDesiredState& PreviousState);
+
+	// Action Events
+
+private:
+	void AddActionEvent(const FAlsActionEvent& Event);
+
+	UFUNCTION()
+	void OnReplicated_ActionEvents();
+
+	void ProcessInitialActionEvents();
+
+	void ProcessActionEvent(const FAlsActionEvent& Event);
+
+	// Significance
+
+public:
+	const FAlsSignificanceState& GetSignificanceState() const;
+
+	void SetSignificance(EAlsSignificance NewSignificance, float NewViewerDistance);
+
+private:
+	void RefreshVisibilityBasedAnimTickOption() const;
+
 	// View Mode
 
 public:
@@ -140,10 +258,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character", Meta = (AutoCreateRefTerm = "NewModeTag"))
 	void SetViewMode(const FGameplayTag& NewModeTag);
 
-private:
-	UFUNCTION(Server, Reliable)
-	void ServerSetViewMode(const FGameplayTag& NewModeTag);
-
 	// Locomotion Mode
 
 public:
@@ -169,13 +283,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character")
 	void SetDesiredAiming(bool bNewDesiredAiming);
 
-private:
-	UFUNCTION(Server, Reliable)
-	void ServerSetDesiredAiming(bool bNewDesiredAiming);
-
-	UFUNCTION()
-	void OnReplicated_DesiredAiming(bool bPreviousDesiredAiming);
-
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character")
 	void OnDesiredAimingChanged(bool bPreviousDesiredAiming);
@@ -188,10 +295,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character", Meta = (AutoCreateRefTerm = "NewModeTag"))
 	void SetDesiredRotationMode(const FGameplayTag& NewModeTag);
 
-private:
-	UFUNCTION(Server, Reliable)
-	void ServerSetDesiredRotationMode(const FGameplayTag& NewModeTag);
-
 	// Rotation Mode
 
 public:
@@ -214,10 +317,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character", Meta = (AutoCreateRefTerm = "NewStanceTag"))
 	void SetDesiredStance(const FGameplayTag& NewStanceTag);
 
-private:
-	UFUNCTION(Server, Reliable)
-	void ServerSetDesiredStance(const FGameplayTag& NewStanceTag);
-
 protected:
 	virtual void ApplyDesiredStance();
 
@@ -248,10 +347,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character", Meta = (AutoCreateRefTerm = "NewGaitTag"))
 	void SetDesiredGait(const FGameplayTag& NewGaitTag);
 
-private:
-	UFUNCTION(Server, Reliable)
-	void ServerSetDesiredGait(const FGameplayTag& NewGaitTag);
-
 	// Gait
 
 public:
@@ -281,13 +376,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character", Meta = (AutoCreateRefTerm = "NewModeTag"))
 	void SetOverlayMode(const FGameplayTag& NewModeTag);
 
-private:
-	UFUNCTION(Server, Reliable)
-	void ServerSetOverlayMode(const FGameplayTag& NewModeTag);
-
-	UFUNCTION()
-	void OnReplicated_OverlayMode(const FGameplayTag& PreviousModeTag);
-
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character")
 	void OnOverlayModeChanged(const FGameplayTag& PreviousModeTag);
@@ -316,6 +404,11 @@ private:
 	UFUNCTION(Server, Unreliable)
 	void ServerSetRawViewRotation(const FRotator& NewViewRotation);
 
+	UFUNCTION(Server, Unreliable)
+	void ServerSetRawViewRotationCompressed(uint32 NewCompressedViewRotation);
+
+	void RefreshCompressedReplication();
+
 	UFUNCTION()
 	void OnReplicated_RawViewRotation();
 
@@ -326,10 +419,20 @@ public:
 	const FAlsViewState& GetViewState() const;
 
 private:
+	void PrepareViewRefresh();
+
 	void RefreshView(float DeltaTime);
 
 	void RefreshViewNetworkSmoothing(float DeltaTime);
 
+	// Shared with the locomotion batch subsystem. The buffer is null if the network smoothing buffer is not used.
+	static void RefreshViewNetworkSmoothingRotation(bool bAllowNetworkSmoothing, const FAlsViewNetworkSmoothingBuffer* Buffer,
+	                                                float MaxExtrapolationTime, float ServerTime, float Duration,
+	                                                const FRotator& RawViewRotation, float DeltaTime, float& ClientTime,
+	                                                FRotator& InitialRotation, FRotator& Rotation);
+
+	static float CalculateViewYawSpeed(const FRotator& Rotation, float PreviousYawAngle, float DeltaTime);
+
 	// Locomotion
 
 public:
@@ -342,8 +445,16 @@ private:
 
 	void RefreshLocomotionLocationAndRotation(float DeltaTime);
 
+	void PrepareLocomotionRefresh();
+
 	void RefreshLocomotion(float DeltaTime);
 
+	// Shared with the locomotion batch subsystem.
+	static void RefreshLocomotionMovement(const FVector& InputDirection, const FVector& Velocity, const FVector& PreviousVelocity,
+	                                      float MovingSpeedThreshold, float DeltaTime, bool& bHasInput, float& InputYawAngle,
+	                                      bool& bHasSpeed, float& Speed, float& VelocityYawAngle, FVector& Acceleration,
+	                                      bool& bMoving);
+
 	// Jumping
 
 public:
@@ -352,9 +463,6 @@ public:
 	virtual void OnJumped_Implementation() override;
 
 private:
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastOnJumpedNetworked();
-
 	void OnJumpedNetworked();
 
 	// Rotation
@@ -412,11 +520,9 @@ public:
 	void UnLockRotation();
 
 private:
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastLockRotation(float TargetYawAngle);
+	void LockRotationImplementation(float TargetYawAngle);
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastUnLockRotation();
+	void UnLockRotationImplementation();
 
 	// Rolling
 
@@ -435,9 +541,6 @@ private:
 	UFUNCTION(Server, Reliable)
 	void ServerStartRolling(UAnimMontage* Montage, float PlayRate, float StartYawAngle, float TargetYawAngle);
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStartRolling(UAnimMontage* Montage, float PlayRate, float StartYawAngle, float TargetYawAngle);
-
 	void StartRollingImplementation(UAnimMontage* Montage, float PlayRate, float StartYawAngle, float TargetYawAngle);
 
 	void RefreshRolling(float DeltaTime);
@@ -456,14 +559,30 @@ public:
 private:
 	bool TryStartMantlingInAir();
 
+	bool TryStartMantlingInAirScheduled();
+
+	bool CalculateMantlingForwardTraceDirection(FVector& ForwardTraceDirection) const;
+
+	FVector CalculateMantlingForwardTraceStart(const FAlsMantlingTraceSettings& TraceSettings, const FVector& ForwardTraceDirection) const;
+
+	float CalculateMantlingForwardTraceCapsuleHalfHeight(const FAlsMantlingTraceSettings& TraceSettings) const;
+
 	bool TryStartMantling(const FAlsMantlingTraceSettings& TraceSettings);
 
+	bool TryStartMantlingFromForwardTraceHit(const FAlsMantlingTraceSettings& TraceSettings, const FHitResult& ForwardTraceHit,
+	                                         const FCollisionObjectQueryParams& ObjectQueryParameters);
+
+	// Returns true if mantling was started using the ledge index of the current level. The traces
+	// are disallowed if the current location is covered by a ledge index and fallback is disabled.
+	bool TryStartMantlingFromLedgeIndex(const FAlsMantlingTraceSettings& TraceSettings, const FVector& ForwardTraceDirection,
+	                                    const FCollisionObjectQueryParams& ObjectQueryParameters, bool& bTracesAllowed);
+
+	void StartMantling(UPrimitiveComponent* TargetPrimitive, const FVector& TargetLocation,
+	                   const FQuat& TargetRotation, float MantlingHeight);
+
 	UFUNCTION(Server, Reliable)
 	void ServerStartMantling(const FAlsMantlingParameters& Parameters);
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStartMantling(const FAlsMantlingParameters& Parameters);
-
 	void StartMantlingImplementation(const FAlsMantlingParameters& Parameters);
 
 protected:
@@ -494,9 +613,6 @@ private:
 	UFUNCTION(Server, Reliable)
 	void ServerStartRagdolling();
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStartRagdolling();
-
 	void StartRagdollingImplementation();
 
 protected:
@@ -513,14 +629,15 @@ private:
 	UFUNCTION(Server, Reliable)
 	void ServerStopRagdolling();
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStopRagdolling();
-
 	void StopRagdollingImplementation();
 
 public:
 	void FinalizeRagdolling();
 
+	const FAlsRagdollingState& GetRagdollingState() const;
+
+	void SetRagdollFullSimulationAllowed(bool bNewAllowed);
+
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character")
 	UAnimMontage* SelectGetUpMontage(bool bRagdollFacedUpward);
@@ -534,8 +651,31 @@ private:
 	UFUNCTION(Server, Unreliable)
 	void ServerSetRagdollTargetLocation(const FVector_NetQuantize100& NewLocation);
 
+	void SetRagdollSnapshot(const FAlsRagdollSnapshot& NewSnapshot);
+
+	UFUNCTION(Server, Unreliable)
+	void ServerSetRagdollSnapshot(const FAlsRagdollSnapshot& NewSnapshot);
+
+	void CaptureRagdollSnapshot(float DeltaTime);
+
+	void ApplyRagdollSnapshot(float DeltaTime);
+
+	void StopApplyingRagdollSnapshot();
+
 	void RefreshRagdolling(float DeltaTime);
 
+	void RefreshRagdollingReducedSimulation();
+
+	void RefreshRagdollingSleep(float DeltaTime);
+
+	void RefreshRagdollingMotors();
+
+	void RefreshRagdollingAsyncState(bool bApplyPullForce, const FName& PullForceBoneName);
+
+	void RefreshRagdollingAsyncBodies();
+
+	void RefreshRagdollingPhysicsThread(float DeltaTime);
+
 	void RefreshRagdollingActorTransform(float DeltaTime);
 
 	// Debug
@@ -558,11 +698,31 @@ private:
 	void DisplayDebugMantling(const UCanvas* Canvas, float Scale, float HorizontalLocation, float& VerticalLocation) const;
 };
 
+inline const UAlsCharacterSettings* AAlsCharacter::GetSettings() const
+{
+	return Settings;
+}
+
 inline bool AAlsCharacter::IsSimulatedProxyTeleported() const
 {
 	return bSimulatedProxyTeleported;
 }
 
+inline const FAlsCompiledState& AAlsCharacter::GetCompiledState() const
+{
+	return CompiledState;
+}
+
+inline const FAlsDesiredState& AAlsCharacter::GetDesiredState() const
+{
+	return DesiredState;
+}
+
+inline const FAlsSignificanceState& AAlsCharacter::GetSignificanceState() const
+{
+	return SignificanceState;
+}
+
 inline const FGameplayTag& AAlsCharacter::GetViewMode() const
 {
 	return ViewMode;
@@ -632,3 +792,8 @@ inline const FAlsLocomotionState& AAlsCharacter::GetLocomotionState() const
 {
 	return LocomotionState;
 }
+
+inline const FAlsRagdollingState& AAlsCharacter::GetRagdollingState() const
+{
+	return RagdollingState;
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "GameFramework/Info.h"
+#include "AlsLedgeIndex.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsLedge
+{
+	GENERATED_BODY()
+
+	// Start of the edge on the walkable top.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector Start{ForceInit};
+
+	// End of the edge on the walkable top.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector End{ForceInit};
+
+	// Horizontal normal of the wall below the edge, points away from the walkable top.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector Normal{ForceInit};
+
+	// Height of the edge above the floor in front of the wall.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float Height{0.0f};
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsLedgeIndexCell
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<int32> LedgeIndices;
+};
+
+// Spatial hash of the mantleable ledges of the static geometry of a level. Built offline by the
+// AlsBuildLedgeIndex commandlet and saved in the level, so it is streamed in and out with the level.
+UCLASS(NotBlueprintable)
+class ALS_API AAlsLedgeIndex : public AInfo
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(VisibleAnywhere, Category = "Settings", Meta = (ClampMin = 1, ForceUnits = "cm"))
+	float CellSize{200.0f};
+
+	// Bounds of the indexed geometry. Locations outside of the bounds are not covered by this index.
+	UPROPERTY(VisibleAnywhere, Category = "State")
+	FBox Bounds{ForceInit};
+
+	UPROPERTY(VisibleAnywhere, Category = "State")
+	TArray<FAlsLedge> Ledges;
+
+	UPROPERTY(VisibleAnywhere, Category = "State")
+	TMap<FIntVector, FAlsLedgeIndexCell> Cells;
+
+public:
+	AAlsLedgeIndex();
+
+protected:
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	void Build(const FBox& NewBounds, const TArray<FAlsLedge>& NewLedges, float NewCellSize);
+
+	bool IsLocationCovered(const FVector& Location) const;
+
+	// Finds the closest ledge in front of the given location, within the reach distance and the height range, facing the
+	// opposite direction. Returns the closest point of the ledge edge to the location, or nullptr if there is no ledge.
+	const FAlsLedge* FindMantlingLedge(const FVector& Location, const FVector& Direction, float ReachDistance,
+	                                   const FFloatInterval& HeightRange, float MaxAngle, FVector& LedgeLocation) const;
+
+	const TArray<FAlsLedge>& GetLedges() const;
+
+private:
+	FIntVector CalculateCell(const FVector& Location) const;
+};
+
+inline bool AAlsLedgeIndex::IsLocationCovered(const FVector& Location) const
+{
+	return Bounds.IsValid && Bounds.IsInsideOrOn(Location);
+}
+
+inline const TArray<FAlsLedge>& AAlsLedgeIndex::GetLedges() const
+{
+	return Ledges;
+}
+
+inline FIntVector AAlsLedgeIndex::CalculateCell(const FVector& Location) const
+{
+	return {
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / CellSize)
+	};
+}
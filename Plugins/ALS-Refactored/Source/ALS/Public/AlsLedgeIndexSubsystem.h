@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsLedgeIndexSubsystem.generated.h"
+
+class AAlsLedgeIndex;
+struct FAlsLedge;
+
+// Keeps track of the ledge indices of the currently loaded levels.
+UCLASS()
+class ALS_API UAlsLedgeIndexSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TArray<TObjectPtr<AAlsLedgeIndex>> LedgeIndices;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	void RegisterLedgeIndex(AAlsLedgeIndex* LedgeIndex);
+
+	void UnregisterLedgeIndex(AAlsLedgeIndex* LedgeIndex);
+
+	bool IsLocationCovered(const FVector& Location) const;
+
+	// Same as AAlsLedgeIndex::FindMantlingLedge(), but searches all ledge indices, since a location
+	// near the border of a level may be within reach of the ledges of several levels.
+	const FAlsLedge* FindMantlingLedge(const FVector& Location, const FVector& Direction, float ReachDistance,
+	                                   const FFloatInterval& HeightRange, float MaxAngle, FVector& LedgeLocation) const;
+};
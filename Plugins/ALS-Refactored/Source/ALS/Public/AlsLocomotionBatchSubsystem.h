@@ -0,0 +1,137 @@
+#pragma once
+
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsLocomotionBatchSubsystem.generated.h"
+
+class AAlsCharacter;
+class UAlsLocomotionBatchSubsystem;
+struct FAlsViewNetworkSmoothingBuffer;
+
+USTRUCT()
+struct ALS_API FAlsLocomotionBatchTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UAlsLocomotionBatchSubsystem* Subsystem{nullptr};
+
+public:
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+	                         const FGraphEventRef& CompletionGraphEvent) override;
+
+	virtual FString DiagnosticMessage() override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsLocomotionBatchTickFunction> : public TStructOpsTypeTraitsBase2<FAlsLocomotionBatchTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+// Structure of arrays with the inputs and outputs of AAlsCharacter::RefreshView().
+struct ALS_API FAlsViewBatch
+{
+	TArray<float> DeltaTimes;
+
+	TArray<bool> NetworkSmoothingEnabled;
+
+	TArray<float> NetworkSmoothingServerTimes;
+
+	TArray<float> NetworkSmoothingClientTimes;
+
+	TArray<float> NetworkSmoothingDurations;
+
+	TArray<FRotator> NetworkSmoothingInitialRotations;
+
+	TArray<FRotator> NetworkSmoothingRotations;
+
+	// Null if the network smoothing buffer is not used.
+	TArray<const FAlsViewNetworkSmoothingBuffer*> NetworkSmoothingBuffers;
+
+	TArray<float> NetworkSmoothingMaxExtrapolationTimes;
+
+	TArray<FRotator> RawViewRotations;
+
+	TArray<float> PreviousYawAngles;
+
+	TArray<float> YawSpeeds;
+
+public:
+	void SetNum(int32 Num);
+};
+
+// Structure of arrays with the inputs and outputs of AAlsCharacter::RefreshLocomotion().
+struct ALS_API FAlsLocomotionBatch
+{
+	TArray<float> DeltaTimes;
+
+	TArray<float> MovingSpeedThresholds;
+
+	TArray<FVector> InputDirections;
+
+	TArray<FVector> Velocities;
+
+	TArray<FVector> PreviousVelocities;
+
+	TArray<bool> HasInput;
+
+	TArray<float> InputYawAngles;
+
+	TArray<bool> HasSpeed;
+
+	TArray<float> Speeds;
+
+	TArray<float> VelocityYawAngles;
+
+	TArray<FVector> Accelerations;
+
+	TArray<bool> Moving;
+
+public:
+	void SetNum(int32 Num);
+};
+
+// Refreshes the view and locomotion state of all registered characters at once before their own tick. Game thread only
+// work is done when gathering the inputs, and the rest is done for all characters in parallel on the worker threads.
+UCLASS()
+class ALS_API UAlsLocomotionBatchSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TArray<TObjectPtr<AAlsCharacter>> Characters;
+
+	FAlsLocomotionBatchTickFunction TickFunction;
+
+	TArray<AAlsCharacter*> BatchedCharacters;
+
+	FAlsViewBatch ViewBatch;
+
+	FAlsLocomotionBatch LocomotionBatch;
+
+public:
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	void RegisterCharacter(AAlsCharacter* Character);
+
+	void UnregisterCharacter(AAlsCharacter* Character);
+
+	void Tick(float DeltaTime);
+
+private:
+	void GatherInputs(float DeltaTime);
+
+	void WriteOutputs();
+
+	static void RefreshViewBatch(FAlsViewBatch& Batch, int32 StartIndex, int32 EndIndex);
+
+	static void RefreshLocomotionBatch(FAlsLocomotionBatch& Batch, int32 StartIndex, int32 EndIndex);
+};
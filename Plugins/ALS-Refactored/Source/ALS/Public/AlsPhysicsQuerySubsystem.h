@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+
+#include "Settings/AlsSignificanceSettings.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsPhysicsQuerySubsystem.generated.h"
+
+UENUM(BlueprintType)
+enum class EAlsPhysicsQueryCategory : uint8
+{
+	FootIk,
+	GroundPrediction,
+	Mantling,
+	Ragdolling,
+	Camera,
+	Footsteps
+};
+
+// Shares per-frame physics query budgets between the ALS features of a world. When a budget runs out, the queries of
+// less significant characters are deferred first, and a deferred caller reuses the result of its last query instead.
+// Queries that can't be deferred, for example because there is no previous result yet, are always allowed, but are
+// still counted against the budgets. The budgets are configured in the [/Script/ALS.AlsPhysicsQuerySubsystem]
+// section of DefaultGame.ini. Queries can be made from worker threads, so the budgets are not strict under contention.
+UCLASS(Config = Game)
+class ALS_API UAlsPhysicsQuerySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	// Maximum number of queries per frame in all categories. Zero means no limit.
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", Meta = (ClampMin = 0))
+	int32 GlobalBudget{0};
+
+	// Maximum number of foot IK queries per frame. Zero means no limit.
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", Meta = (ClampMin = 0))
+	int32 FootIkBudget{0};
+
+	// Maximum number of ground prediction queries per frame. Zero means no limit.
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", Meta = (ClampMin = 0))
+	int32 GroundPredictionBudget{0};
+
+	// Maximum number of mantling queries per frame. Zero means no limit.
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", Meta = (ClampMin = 0))
+	int32 MantlingBudget{0};
+
+	// Maximum number of ragdolling queries per frame. Zero means no limit.
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", Meta = (ClampMin = 0))
+	int32 RagdollingBudget{0};
+
+	// Maximum number of camera queries per frame. Zero means no limit.
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", Meta = (ClampMin = 0))
+	int32 CameraBudget{0};
+
+	// Maximum number of footstep effects queries per frame. Zero means no limit.
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", Meta = (ClampMin = 0))
+	int32 FootstepsBudget{0};
+
+	// Share of each budget available to high significance characters. Critical significance characters can use the whole budget.
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", Meta = (ClampMin = 0, ClampMax = 1))
+	float HighSignificanceBudgetShare{0.75f};
+
+	// Share of each budget available to medium significance characters.
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", Meta = (ClampMin = 0, ClampMax = 1))
+	float MediumSignificanceBudgetShare{0.5f};
+
+	// Share of each budget available to low significance characters.
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", Meta = (ClampMin = 0, ClampMax = 1))
+	float LowSignificanceBudgetShare{0.25f};
+
+	// Number of the frame the query counters below belong to.
+	std::atomic<uint64> FrameNumber{0};
+
+	std::atomic<int32> GlobalQueriesCount{0};
+
+	std::atomic<int32> CategoryQueriesCounts[static_cast<uint8>(EAlsPhysicsQueryCategory::Footsteps) + 1]{};
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	// Returns true if the caller is allowed to perform the given number of queries in this frame. If false is
+	// returned, the caller should reuse the result of its last query. Can be called from any thread.
+	bool TryAcquireQueries(EAlsPhysicsQueryCategory Category, EAlsSignificance Significance,
+	                       bool bAllowDeferral = true, int32 QueriesCount = 1);
+
+	// Same as above, but allows all queries if the world has no physics query subsystem.
+	static bool TryAcquireWorldQueries(const UWorld* World, EAlsPhysicsQueryCategory Category, EAlsSignificance Significance,
+	                                   bool bAllowDeferral = true, int32 QueriesCount = 1);
+
+private:
+	void RefreshFrame();
+
+	int32 GetCategoryBudget(EAlsPhysicsQueryCategory Category) const;
+
+	float GetSignificanceBudgetShare(EAlsSignificance Significance) const;
+};
+
+inline int32 UAlsPhysicsQuerySubsystem::GetCategoryBudget(const EAlsPhysicsQueryCategory Category) const
+{
+	switch (Category)
+	{
+		case EAlsPhysicsQueryCategory::FootIk:
+			return FootIkBudget;
+
+		case EAlsPhysicsQueryCategory::GroundPrediction:
+			return GroundPredictionBudget;
+
+		case EAlsPhysicsQueryCategory::Mantling:
+			return MantlingBudget;
+
+		case EAlsPhysicsQueryCategory::Ragdolling:
+			return RagdollingBudget;
+
+		case EAlsPhysicsQueryCategory::Camera:
+			return CameraBudget;
+
+		default:
+			return FootstepsBudget;
+	}
+}
+
+inline float UAlsPhysicsQuerySubsystem::GetSignificanceBudgetShare(const EAlsSignificance Significance) const
+{
+	switch (Significance)
+	{
+		case EAlsSignificance::High:
+			return HighSignificanceBudgetShare;
+
+		case EAlsSignificance::Medium:
+			return MediumSignificanceBudgetShare;
+
+		case EAlsSignificance::Low:
+			return LowSignificanceBudgetShare;
+
+		default:
+			return 1.0f;
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Settings/AlsSignificanceSettings.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsSignificanceSubsystem.generated.h"
+
+class AAlsCharacter;
+class APlayerController;
+
+// Periodically scores every registered character by its distance to the viewers, visibility, net role and
+// locomotion action, and puts it into a significance bucket, which controls how often the character is updated.
+// Also limits the number of fully simulated ragdolls, so that only the ones closest to the viewers are fully simulated.
+// The limit is configured in the [/Script/ALS.AlsSignificanceSubsystem] section of DefaultGame.ini.
+UCLASS(Config = Game)
+class ALS_API UAlsSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	// Maximum number of fully simulated ragdolls in the world. Ragdolls farther from the viewers
+	// than the closest ones use the reduced simulation. Zero means no limit.
+	UPROPERTY(EditAnywhere, Config, Category = "Settings", Meta = (ClampMin = 0))
+	int32 MaxFullySimulatedRagdolls{0};
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TArray<TObjectPtr<AAlsCharacter>> Characters;
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TArray<FVector> ViewLocations;
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TArray<TObjectPtr<const APlayerController>> ViewPlayerControllers;
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient, Meta = (ForceUnits = "s"))
+	float UpdateTimeRemaining{0.0f};
+
+public:
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	void RegisterCharacter(AAlsCharacter* Character);
+
+	void UnregisterCharacter(AAlsCharacter* Character);
+
+	const TArray<TObjectPtr<AAlsCharacter>>& GetCharacters() const;
+
+private:
+	void RefreshViewLocations();
+
+	EAlsSignificance CalculateSignificance(const AAlsCharacter* Character) const;
+
+	void RefreshRagdollsFullSimulation(TArrayView<AAlsCharacter*> RagdollingCharacters) const;
+
+	float CalculateViewerDistance(const AAlsCharacter* Character) const;
+};
+
+inline const TArray<TObjectPtr<AAlsCharacter>>& UAlsSignificanceSubsystem::GetCharacters() const
+{
+	return Characters;
+}
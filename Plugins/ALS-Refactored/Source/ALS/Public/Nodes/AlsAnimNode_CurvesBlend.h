@@ -3,6 +3,9 @@
 #include "Animation/AnimNodeBase.h"
 #include "AlsAnimNode_CurvesBlend.generated.h"
 
+class UAnimSequenceBase;
+struct FAnimNode_SequencePlayerBase;
+
 UENUM(BlueprintType)
 enum class EAlsCurvesBlendMode : uint8
 {
@@ -40,6 +43,23 @@ public:
 	EAlsCurvesBlendMode BlendMode{EAlsCurvesBlendMode::BlendByAmount};
 #endif
 
+	// If checked and the curves pose is directly linked to a sequence player, then only the curves of its
+	// sequence will be evaluated, without evaluating the bones, which are not used by this node anyway.
+	// Any other curves pose (blend spaces, sequence evaluators, slots with montages, cached poses,
+	// etc.) is fully evaluated as if this option was unchecked, and a warning is logged. Additive
+	// sequences are fully evaluated too, because their curves are converted to additive on evaluation.
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	bool bEvaluateCurvesOnly{false};
+
+private:
+	FAnimNode_SequencePlayerBase* CurvesSequencePlayer{nullptr};
+
+	bool bCurvesOnlyFallbackLogged{false};
+
+#if STATS
+	int32 TimeSavedSampleCounter{0};
+#endif
+
 public:
 	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
 
@@ -55,4 +75,12 @@ public:
 	float GetBlendAmount() const;
 
 	EAlsCurvesBlendMode GetBlendMode() const;
+
+	static bool CanEvaluateCurvesOnly(const UAnimSequenceBase* Sequence);
+
+	// Evaluates only the curves of the sequence, the result must match the curves of the fully evaluated sequence.
+	static void EvaluateCurvesOnly(const UAnimSequenceBase* Sequence, float Time, FBlendedCurve& Curve);
+
+private:
+	void BlendCurves(FBlendedCurve& Curve, const FBlendedCurve& OtherCurve, float Amount) const;
 };
@@ -18,6 +18,18 @@ public:
 	TArray<FGameplayTag> Tags;
 #endif
 
+public:
+	// If checked, the tags are compiled into a hashed map on initialization, and poses are switched using
+	// inertialization, so only the active pose is evaluated. Requires an inertialization node later in the graph.
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	bool bUseInertialBlend{false};
+
+private:
+	TMap<FGameplayTag, int32> TagIndices;
+
+public:
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+
 protected:
 	virtual int32 GetActiveChildIndex() override;
 
@@ -28,5 +40,7 @@ public:
 
 #if WITH_EDITOR
 	void RefreshPoses();
+
+	void RefreshTransitionType();
 #endif
 };
@@ -43,4 +43,13 @@ public:
 
 public:
 	UAlsAnimationInstanceSettings();
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	void BakeCurves();
 };
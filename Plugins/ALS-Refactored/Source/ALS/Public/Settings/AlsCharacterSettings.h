@@ -4,6 +4,7 @@
 #include "AlsMantlingSettings.h"
 #include "AlsRagdollingSettings.h"
 #include "AlsRollingSettings.h"
+#include "AlsSignificanceSettings.h"
 #include "AlsViewSettings.h"
 #include "Engine/DataAsset.h"
 #include "AlsCharacterSettings.generated.h"
@@ -29,6 +30,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	bool bAllowAimingWhenInAir{true};
 
+	// If checked, the view and locomotion state will be refreshed for all characters at once
+	// by the locomotion batch subsystem, which spreads this work across the worker threads.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	bool bUseBatchedLocomotionRefresh{false};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsViewSettings View;
 
@@ -41,6 +47,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsRollingSettings Rolling;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsSignificanceSettings Significance;
+
 public:
 	UAlsCharacterSettings();
 };
@@ -24,4 +24,13 @@ struct ALS_API FAlsFeetSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
 	float IkTraceDistanceDownward{45.0f};
+
+	// If checked, the foot IK traces will be performed asynchronously using the world's async trace API, and their
+	// results will be used in the next frame. If the result is missing or too old, a regular trace will be used instead.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (InlineEditConditionToggle))
+	bool bUseAsyncIkTraces{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		DisplayName = "Use Async Ik Traces", Meta = (ClampMin = 0, ForceUnits = "s", EditCondition = "bUseAsyncIkTraces"))
+	float AsyncIkTraceMaxAge{0.1f};
 };
@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include "Utility/AlsBakedCurve.h"
 #include "AlsGroundedSettings.generated.h"
 
 class UCurveFloat;
@@ -46,4 +47,19 @@ struct ALS_API FAlsGroundedSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
 	float PivotActivationSpeedThreshold{200.0f};
+
+	FAlsBakedCurve BakedStrideBlendAmountWalkCurve;
+
+	FAlsBakedCurve BakedStrideBlendAmountRunCurve;
+
+	FAlsBakedCurve BakedRotationYawOffsetForwardCurve;
+
+	FAlsBakedCurve BakedRotationYawOffsetBackwardCurve;
+
+	FAlsBakedCurve BakedRotationYawOffsetLeftCurve;
+
+	FAlsBakedCurve BakedRotationYawOffsetRightCurve;
+
+public:
+	void BakeCurves();
 };
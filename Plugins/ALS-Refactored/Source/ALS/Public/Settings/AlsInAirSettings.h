@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "Engine/EngineTypes.h"
+#include "Utility/AlsBakedCurve.h"
 #include "AlsInAirSettings.generated.h"
 
 class UCurveFloat;
@@ -20,4 +21,11 @@ struct ALS_API FAlsInAirSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TArray<TEnumAsByte<EObjectTypeQuery>> GroundPredictionSweepObjectTypes;
+
+	FAlsBakedCurve BakedLeanAmountCurve;
+
+	FAlsBakedCurve BakedGroundPredictionAmountCurve;
+
+public:
+	void BakeCurves();
 };
@@ -2,6 +2,7 @@
 
 #include "Engine/DataAsset.h"
 #include "Engine/EngineTypes.h"
+#include "Utility/AlsBakedCurve.h"
 #include "AlsMantlingSettings.generated.h"
 
 class UAnimMontage;
@@ -66,6 +67,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0))
 	FVector2D PlayRate{1.0f, 1.0f};
 
+	FAlsBakedCurve BakedBlendInCurve;
+
+	FAlsBakedCurve BakedInterpolationAndCorrectionAmountsCurve;
+
+public:
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	void BakeCurves();
+
 public:
 	float CalculateStartTime(float MantlingHeight) const;
 
@@ -100,6 +115,26 @@ struct ALS_API FAlsMantlingTraceSettings
 	bool bDrawFailedTraces{false};
 };
 
+USTRUCT(BlueprintType)
+struct ALS_API FAlsInAirMantlingSchedulerSettings
+{
+	GENERATED_BODY()
+
+	// If checked, in-air mantling checks are skipped while they can't succeed, the forward trace is performed
+	// asynchronously and its result is used in the next frame, and the time between checks is adapted
+	// to the distance to the nearest obstacle in front of the character and to the vertical speed.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bEnabled{false};
+
+	// If checked, in-air mantling checks are skipped while there is no movement input.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bEnabled"))
+	bool bRequireInput{true};
+
+	// Minimum and maximum time between in-air mantling checks.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, EditCondition = "bEnabled", ForceUnits = "s"))
+	FVector2D CheckInterval{0.0f, 0.15f};
+};
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsGeneralMantlingSettings
 {
@@ -127,6 +162,19 @@ struct ALS_API FAlsGeneralMantlingSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FAlsMantlingTraceSettings InAirTrace{{50.0f, 150.0f}, 70.0f};
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsInAirMantlingSchedulerSettings InAirScheduler;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TArray<TEnumAsByte<EObjectTypeQuery>> MantlingTraceObjectTypes;
+
+	// If checked, mantling candidates are looked up in the ledge indices of the loaded levels and confirmed with a ledge
+	// sweep and a clearance sweep. The ledge indices are built from the static level geometry by the AlsBuildLedgeIndex commandlet.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bUseLedgeIndex{false};
+
+	// If checked, the regular traces are used when the ledge index has no confirmed candidate,
+	// so that movable geometry, which is not in the ledge index, can still be mantled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bUseLedgeIndex"))
+	bool bFallBackToTracesWithLedgeIndex{true};
 };
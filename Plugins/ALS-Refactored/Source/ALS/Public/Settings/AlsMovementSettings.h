@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "Engine/DataAsset.h"
+#include "Utility/AlsBakedCurve.h"
 #include "Utility/AlsGameplayTags.h"
 #include "AlsMovementSettings.generated.h"
 
@@ -32,8 +33,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UCurveFloat> RotationInterpolationSpeedCurve{nullptr};
 
+	FAlsBakedCurve BakedAccelerationAndDecelerationAndGroundFrictionCurve;
+
+	FAlsBakedCurve BakedRotationInterpolationSpeedCurve;
+
 public:
 	float GetSpeedForGait(const FGameplayTag& GaitTag) const;
+
+	void BakeCurves();
 };
 
 inline float FAlsMovementGaitSettings::GetSpeedForGait(const FGameplayTag& GaitTag) const
@@ -82,4 +89,14 @@ public:
 		{AlsRotationModeTags::LookingDirection, {}},
 		{AlsRotationModeTags::Aiming, {}}
 	};
+
+public:
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	void BakeCurves();
 };
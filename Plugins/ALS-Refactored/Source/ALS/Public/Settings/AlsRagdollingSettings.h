@@ -24,4 +24,68 @@ struct ALS_API FAlsRagdollingSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UAnimMontage> GetUpBackMontage{nullptr};
+
+	// If checked, the ragdoll speed limit and pull force are applied on the async physics tick at a fixed step, instead of on the
+	// game thread at the frame rate. Requires the async physics tick to be enabled in the project physics settings.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bUseAsyncPhysicsTick{false};
+
+	// If checked, the locally controlled character replicates a snapshot of the key ragdoll bodies, and other machines
+	// blend their bodies toward it instead of pulling the whole ragdoll toward the replicated target location.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bEnableSnapshotReplication{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bEnableSnapshotReplication"))
+	TArray<FName> SnapshotBones{
+		TEXT("pelvis"), TEXT("spine_03"), TEXT("head"), TEXT("lowerarm_l"), TEXT("lowerarm_r"), TEXT("calf_l"), TEXT("calf_r")
+	};
+
+	// Ragdoll root bone speeds at which the snapshot send rates are used.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bEnableSnapshotReplication", ForceUnits = "cm/s"))
+	FVector2D SnapshotSendRateSpeed{50.0f, 500.0f};
+
+	// Number of snapshots sent per second at the corresponding ragdoll root bone speed. Interpolated between the speeds.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0.1, EditCondition = "bEnableSnapshotReplication"))
+	FVector2D SnapshotSendRate{2.0f, 15.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bEnableSnapshotReplication"))
+	float SnapshotBlendSpeed{10.0f};
+
+	// Simulated proxies farther than this distance from the nearest viewer don't simulate ragdoll physics
+	// and only follow the replicated target location, while their mesh keeps playing the ragdoll animation.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bEnableSnapshotReplication", ForceUnits = "cm"))
+	float SnapshotPhysicsDistance{5000.0f};
+
+	// Ragdoll root bone speed below which the ragdoll is considered settled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm/s"))
+	float SleepSpeedThreshold{5.0f};
+
+	// Time the ragdoll must stay settled on the ground before it's put to sleep. Zero means never put the ragdoll to sleep.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float SleepDelay{0.0f};
+
+	// Minimum change in the motor angular drive stiffness required to update the motors.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float MotorStiffnessUpdateThreshold{500.0f};
+
+	// Ragdolls farther than this distance from the nearest viewer use the reduced simulation.
+	// Zero means never reduce the simulation because of the distance.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float ReducedSimulationDistance{0.0f};
+
+	// Bodies below these bones are not simulated when the reduced simulation is used, they follow the animation instead.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FName> ReducedSimulationBones{TEXT("lowerarm_l"), TEXT("lowerarm_r"), TEXT("calf_l"), TEXT("calf_r")};
+
+public:
+	float CalculateSnapshotSendRate(float RootBoneSpeed) const;
 };
+
+inline float FAlsRagdollingSettings::CalculateSnapshotSendRate(const float RootBoneSpeed) const
+{
+	return UE_REAL_TO_FLOAT(FMath::GetMappedRangeValueClamped(SnapshotSendRateSpeed, SnapshotSendRate, RootBoneSpeed));
+}
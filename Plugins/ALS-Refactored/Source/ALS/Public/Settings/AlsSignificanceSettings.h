@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Components/SkinnedMeshComponent.h"
+#include "AlsSignificanceSettings.generated.h"
+
+UENUM(BlueprintType)
+enum class EAlsSignificance : uint8
+{
+	// Locally controlled players, characters controlled by a remote client
+	// on the server and characters that are currently performing an action.
+	Critical,
+	High,
+	Medium,
+	Low
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsSignificanceBucketSettings
+{
+	GENERATED_BODY()
+
+	// Minimum time between two full character updates. Skipped frames are extrapolated. Zero means update every frame.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1, ForceUnits = "s"))
+	float TickInterval{0.0f};
+
+	// Never ticks the pose less often than the tick option set in the character's mesh defaults.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	EVisibilityBasedAnimTickOption VisibilityBasedAnimTickOption{EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bAllowViewNetworkSmoothing{true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bAllowInAirMantling{true};
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsSignificanceSettings
+{
+	GENERATED_BODY()
+
+	// If a character is closer than the specified distance to any viewer, then it has high significance.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float HighSignificanceDistance{1500.0f};
+
+	// If a character is closer than the specified distance to any viewer, then it has medium significance, otherwise low.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float MediumSignificanceDistance{4000.0f};
+
+	// Characters that have not been rendered recently are moved to the next less significant bucket.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bLowerSignificanceWhenNotRendered{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsSignificanceBucketSettings Critical;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsSignificanceBucketSettings High;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsSignificanceBucketSettings Medium;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsSignificanceBucketSettings Low;
+
+public:
+	const FAlsSignificanceBucketSettings& GetBucketSettings(EAlsSignificance Significance) const;
+};
+
+inline const FAlsSignificanceBucketSettings& FAlsSignificanceSettings::GetBucketSettings(const EAlsSignificance Significance) const
+{
+	switch (Significance)
+	{
+		case EAlsSignificance::High:
+			return High;
+
+		case EAlsSignificance::Medium:
+			return Medium;
+
+		case EAlsSignificance::Low:
+			return Low;
+
+		default:
+			return Critical;
+	}
+}
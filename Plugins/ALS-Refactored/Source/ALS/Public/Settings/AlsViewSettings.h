@@ -12,4 +12,50 @@ struct ALS_API FAlsViewSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS")
 	bool bEnableListenServerNetworkSmoothing{true};
+
+	// If checked, the last received view rotations are kept with their server timestamps and interpolated with
+	// a cubic Hermite spline instead of linearly, which looks smooth at a much lower view update rate.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS")
+	bool bEnableNetworkSmoothingBuffer{false};
+
+	// Maximum time the view rotation is extrapolated past the last received one when the next one is late.
+	// After that, the view rotation returns to the last received one over the same time.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 0, ClampMax = 1, EditCondition = "bEnableNetworkSmoothingBuffer", ForceUnits = "s"))
+	float NetworkSmoothingMaxExtrapolationTime{0.1f};
+
+	// If checked, the view rotation is sent to the server as 16-bit quantized yaw and pitch angles at a limited rate,
+	// and the view rotation and input direction are replicated to simulated proxies at a rate that depends on the
+	// distance to the nearest remote viewer. View network smoothing interpolates between the less frequent updates.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS")
+	bool bEnableCompressedReplication{false};
+
+	// View rotation changes smaller than this angle are not sent to the server until the view rotation stops changing.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 0, ClampMax = 10, EditCondition = "bEnableCompressedReplication", ForceUnits = "deg"))
+	float ReplicationDeadbandAngle{0.25f};
+
+	// Maximum number of times per second the view rotation is sent to the server.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 1, EditCondition = "bEnableCompressedReplication"))
+	float ServerSendRate{30.0f};
+
+	// Distances to the nearest remote viewer at which the simulated proxy update rates are used.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bEnableCompressedReplication", ForceUnits = "cm"))
+	FVector2D ProxyUpdateDistance{1500.0f, 6000.0f};
+
+	// Maximum number of times per second the view rotation and input direction are replicated to simulated proxies
+	// when the nearest remote viewer is at the corresponding distance. Interpolated between the distances.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 1, EditCondition = "bEnableCompressedReplication"))
+	FVector2D ProxyUpdateRate{30.0f, 5.0f};
+
+public:
+	float CalculateProxyUpdateRate(float ViewerDistance) const;
 };
+
+inline float FAlsViewSettings::CalculateProxyUpdateRate(const float ViewerDistance) const
+{
+	return UE_REAL_TO_FLOAT(FMath::GetMappedRangeValueClamped(ProxyUpdateDistance, ProxyUpdateRate, ViewerDistance));
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Settings/AlsMantlingSettings.h"
+#include "AlsActionEventsState.generated.h"
+
+class UAnimMontage;
+
+UENUM(BlueprintType)
+enum class EAlsActionEventType : uint8
+{
+	None,
+	Jump,
+	LockRotation,
+	UnLockRotation,
+	StartRolling,
+	StartMantling,
+	StartRagdolling,
+	StopRagdolling
+};
+
+// Only the payload fields used by the event type are meaningful, the rest keep their previous
+// values, so that overwriting an event replicates only the fields that have actually changed.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsActionEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	EAlsActionEventType Type{EAlsActionEventType::None};
+
+	// Used by rolling.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TObjectPtr<UAnimMontage> Montage;
+
+	// Used by rolling.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float PlayRate{1.0f};
+
+	// Used by rolling.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float StartYawAngle{0.0f};
+
+	// Used by rolling and rotation locking.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
+	float TargetYawAngle{0.0f};
+
+	// Used by mantling.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsMantlingParameters MantlingParameters;
+};
+
+// Ring buffer of the most recent action events, replicated as a property instead of reliable multicast RPCs. The event
+// with the sequence number N is stored at index N modulo the ring size. Sequence numbers wrap around after 255.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsActionEventsState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	FAlsActionEvent Events[8];
+
+	// Sequence number of the most recent event.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS")
+	uint8 SequenceNumber{0};
+
+public:
+	static constexpr uint8 Capacity{UE_ARRAY_COUNT(Events)};
+
+	// Overwrites the oldest event. Only the payload used by the event type is copied, so
+	// that unchanged fields of the overwritten event are not replicated again.
+	void AddEvent(const FAlsActionEvent& Event);
+
+	// Returns the number of events added after the given sequence number that are still in the ring.
+	uint8 GetEventsCountSince(uint8 ProcessedSequenceNumber) const;
+
+	const FAlsActionEvent& GetEvent(uint8 EventSequenceNumber) const;
+};
+
+inline uint8 FAlsActionEventsState::GetEventsCountSince(const uint8 ProcessedSequenceNumber) const
+{
+	// If more events were added since then than the ring can hold, then the oldest of them are lost.
+
+	return FMath::Min(static_cast<uint8>(SequenceNumber - ProcessedSequenceNumber), Capacity);
+}
+
+inline const FAlsActionEvent& FAlsActionEventsState::GetEvent(const uint8 EventSequenceNumber) const
+{
+	return Events[EventSequenceNumber % Capacity];
+}
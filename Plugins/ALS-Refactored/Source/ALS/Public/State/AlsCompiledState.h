@@ -0,0 +1,194 @@
+#pragma once
+
+#include "GameplayTagContainer.h"
+
+class FNativeGameplayTag;
+
+// Each compiled enumeration has a value for every built-in ALS tag, plus a value for an empty
+// tag and a value for any other tag, so a custom tag never matches any of the built-in ones.
+
+enum class EAlsCompiledViewMode : uint8
+{
+	None,
+	FirstPerson,
+	ThirdPerson,
+	Custom
+};
+
+enum class EAlsCompiledLocomotionMode : uint8
+{
+	None,
+	Grounded,
+	InAir,
+	Custom
+};
+
+enum class EAlsCompiledRotationMode : uint8
+{
+	None,
+	LookingDirection,
+	VelocityDirection,
+	Aiming,
+	Custom
+};
+
+enum class EAlsCompiledStance : uint8
+{
+	None,
+	Standing,
+	Crouching,
+	Custom
+};
+
+enum class EAlsCompiledGait : uint8
+{
+	None,
+	Walking,
+	Running,
+	Sprinting,
+	Custom
+};
+
+enum class EAlsCompiledOverlayMode : uint8
+{
+	None,
+	Default,
+	Masculine,
+	Feminine,
+	Injured,
+	HandsTied,
+	M4,
+	PistolOneHanded,
+	PistolTwoHanded,
+	Bow,
+	Torch,
+	Binoculars,
+	Box,
+	Barrel,
+	Custom
+};
+
+enum class EAlsCompiledLocomotionAction : uint8
+{
+	None,
+	Rolling,
+	Mantling,
+	Ragdolling,
+	GettingUp,
+	Custom
+};
+
+// Built-in tags in the same order as the corresponding compiled enumeration values, starting from the value after None.
+namespace AlsCompiledState
+{
+	ALS_API TConstArrayView<const FNativeGameplayTag*> GetViewModeTags();
+
+	ALS_API TConstArrayView<const FNativeGameplayTag*> GetLocomotionModeTags();
+
+	ALS_API TConstArrayView<const FNativeGameplayTag*> GetRotationModeTags();
+
+	ALS_API TConstArrayView<const FNativeGameplayTag*> GetStanceTags();
+
+	ALS_API TConstArrayView<const FNativeGameplayTag*> GetGaitTags();
+
+	ALS_API TConstArrayView<const FNativeGameplayTag*> GetOverlayModeTags();
+
+	ALS_API TConstArrayView<const FNativeGameplayTag*> GetLocomotionActionTags();
+}
+
+// Bit-packed copy of the character state tags, used by the native code to avoid gameplay tag comparisons in hot
+// paths. The gameplay tags remain the source of truth, this state must be refreshed every time one of them changes.
+struct ALS_API FAlsCompiledState
+{
+private:
+	uint32 ViewMode : 2;
+
+	uint32 LocomotionMode : 2;
+
+	uint32 RotationMode : 3;
+
+	uint32 Stance : 2;
+
+	uint32 Gait : 3;
+
+	uint32 OverlayMode : 4;
+
+	uint32 LocomotionAction : 3;
+
+public:
+	FAlsCompiledState();
+
+	EAlsCompiledViewMode GetViewMode() const;
+
+	void SetViewMode(const FGameplayTag& NewModeTag);
+
+	EAlsCompiledLocomotionMode GetLocomotionMode() const;
+
+	void SetLocomotionMode(const FGameplayTag& NewModeTag);
+
+	EAlsCompiledRotationMode GetRotationMode() const;
+
+	void SetRotationMode(const FGameplayTag& NewModeTag);
+
+	EAlsCompiledStance GetStance() const;
+
+	void SetStance(const FGameplayTag& NewStanceTag);
+
+	EAlsCompiledGait GetGait() const;
+
+	void SetGait(const FGameplayTag& NewGaitTag);
+
+	EAlsCompiledOverlayMode GetOverlayMode() const;
+
+	void SetOverlayMode(const FGameplayTag& NewModeTag);
+
+	EAlsCompiledLocomotionAction GetLocomotionAction() const;
+
+	void SetLocomotionAction(const FGameplayTag& NewActionTag);
+};
+
+static_assert(sizeof(FAlsCompiledState) <= sizeof(uint64));
+
+inline FAlsCompiledState::FAlsCompiledState()
+	: ViewMode{static_cast<uint8>(EAlsCompiledViewMode::None)},
+	  LocomotionMode{static_cast<uint8>(EAlsCompiledLocomotionMode::None)},
+	  RotationMode{static_cast<uint8>(EAlsCompiledRotationMode::None)},
+	  Stance{static_cast<uint8>(EAlsCompiledStance::None)},
+	  Gait{static_cast<uint8>(EAlsCompiledGait::None)},
+	  OverlayMode{static_cast<uint8>(EAlsCompiledOverlayMode::None)},
+	  LocomotionAction{static_cast<uint8>(EAlsCompiledLocomotionAction::None)} {}
+
+inline EAlsCompiledViewMode FAlsCompiledState::GetViewMode() const
+{
+	return static_cast<EAlsCompiledViewMode>(ViewMode);
+}
+
+inline EAlsCompiledLocomotionMode FAlsCompiledState::GetLocomotionMode() const
+{
+	return static_cast<EAlsCompiledLocomotionMode>(LocomotionMode);
+}
+
+inline EAlsCompiledRotationMode FAlsCompiledState::GetRotationMode() const
+{
+	return static_cast<EAlsCompiledRotationMode>(RotationMode);
+}
+
+inline EAlsCompiledStance FAlsCompiledState::GetStance() const
+{
+	return static_cast<EAlsCompiledStance>(Stance);
+}
+
+inline EAlsCompiledGait FAlsCompiledState::GetGait() const
+{
+	return static_cast<EAlsCompiledGait>(Gait);
+}
+
+inline EAlsCompiledOverlayMode FAlsCompiledState::GetOverlayMode() const
+{
+	return static_cast<EAlsCompiledOverlayMode>(OverlayMode);
+}
+
+inline EAlsCompiledLocomotionAction FAlsCompiledState::GetLocomotionAction() const
+{
+	return static_cast<EAlsCompiledLocomotionAction>(LocomotionAction);
+}
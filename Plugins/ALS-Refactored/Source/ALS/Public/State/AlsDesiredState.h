@@ -0,0 +1,59 @@
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "Utility/AlsGameplayTags.h"
+#include "AlsDesiredState.generated.h"
+
+// Replicated copy of the character's desired state. Built-in ALS tags are packed into a few bits
+// each, and any other tag is serialized after an escape value using the gameplay tag serialization.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsDesiredState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bAiming{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag RotationMode{AlsRotationModeTags::LookingDirection};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Stance{AlsStanceTags::Standing};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Gait{AlsGaitTags::Running};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag ViewMode{AlsViewModeTags::ThirdPerson};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag OverlayMode{AlsOverlayModeTags::Default};
+
+public:
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+
+	bool operator==(const FAlsDesiredState& Other) const;
+
+	bool operator!=(const FAlsDesiredState& Other) const;
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsDesiredState> : public TStructOpsTypeTraitsBase2<FAlsDesiredState>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true
+	};
+};
+
+inline bool FAlsDesiredState::operator==(const FAlsDesiredState& Other) const
+{
+	return bAiming == Other.bAiming && RotationMode == Other.RotationMode && Stance == Other.Stance &&
+	       Gait == Other.Gait && ViewMode == Other.ViewMode && OverlayMode == Other.OverlayMode;
+}
+
+inline bool FAlsDesiredState::operator!=(const FAlsDesiredState& Other) const
+{
+	return !(*this == Other);
+}
@@ -1,8 +1,38 @@
 ﻿#pragma once
 
+#include "WorldCollision.h"
+#include "Engine/HitResult.h"
 #include "Utility/AlsMath.h"
 #include "AlsFeetState.generated.h"
 
+USTRUCT(BlueprintType)
+struct ALS_API FAlsFootIkTraceState
+{
+	GENERATED_BODY()
+
+	// Handle of the asynchronous trace requested in the previous frame.
+	FTraceHandle PendingHandle;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector PendingLocation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
+	float PendingTime{0.0f};
+
+	// Indicates that the last asynchronous trace result is not too old and can be used instead of a regular trace.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bHitValid{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FHitResult Hit;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector Location{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
+	float Time{0.0f};
+};
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsFootState
 {
@@ -53,6 +83,9 @@ struct ALS_API FAlsFootState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FQuat OffsetRotation{ForceInit};
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsFootIkTraceState IkTrace;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FVector IkLocation{ForceInit};
 
@@ -0,0 +1,17 @@
+﻿#pragma once
+
+#include "WorldCollision.h"
+#include "AlsMantlingState.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsMantlingState
+{
+	GENERATED_BODY()
+
+	// Handle of the asynchronous in-air forward trace requested in the previous frame.
+	FTraceHandle InAirForwardTraceHandle;
+
+	// World time after which the next in-air mantling check can be performed.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
+	float InAirNextCheckTime{0.0f};
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "AlsRagdollSnapshot.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsRagdollSnapshotBody
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector Location{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator Rotation{ForceInit};
+};
+
+// World transforms of the key ragdoll bodies, in the order of FAlsRagdollingSettings::SnapshotBones. Locations
+// are quantized to a tenth of a centimeter and rotations to 16 bits per axis when the snapshot is replicated.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsRagdollSnapshot
+{
+	GENERATED_BODY()
+
+	static constexpr auto MaxBodies{16};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FAlsRagdollSnapshotBody> Bodies;
+
+public:
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsRagdollSnapshot> : public TStructOpsTypeTraitsBase2<FAlsRagdollSnapshot>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
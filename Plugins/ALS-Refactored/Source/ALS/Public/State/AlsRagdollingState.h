@@ -2,6 +2,8 @@
 
 #include "AlsRagdollingState.generated.h"
 
+class FSingleParticlePhysicsProxy;
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsRagdollingState
 {
@@ -27,4 +29,65 @@ struct ALS_API FAlsRagdollingState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	bool bPendingFinalization{false};
+
+	// Time remaining until the next ragdoll snapshot is captured by the locally controlled character.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float SnapshotDelay{0.0f};
+
+	// True if the physics simulation is suspended on a distant simulated proxy.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bPhysicsSuspended{false};
+
+	// True if the snapshot bodies are kinematic and moved toward the replicated ragdoll snapshot.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bSnapshotBodiesKinematic{false};
+
+	// Set by the significance subsystem, false if there are too many fully simulated ragdolls closer to the viewers.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bFullSimulationAllowed{true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bReducedSimulation{false};
+
+	// Time the ragdoll has been settled on the ground.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float SettledTime{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bSleeping{false};
+
+	// Last angular drive stiffness applied to the motors, negative if not applied yet.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	float MotorStiffness{-1.0f};
+
+	// Distance from the target location to the ground found by the last ground trace,
+	// used when the ground trace is deferred. Negative if there is no ground trace result yet.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "cm"))
+	float GroundDistance{-1.0f};
+};
+
+// Ragdolling state shared between the game thread and the async physics tick. Must only be accessed under a lock.
+struct ALS_API FAlsRagdollingAsyncState
+{
+	bool bActive{false};
+
+	bool bApplyPullForce{false};
+
+	FName PullForceBoneName;
+
+	// Physics proxies of the bodies below the pelvis, cached on the game thread whenever the set of
+	// simulated bodies changes, because the async physics tick must not access the body instances.
+	TArray<FSingleParticlePhysicsProxy*> BodyProxies;
+
+	FSingleParticlePhysicsProxy* PullForceBodyProxy{nullptr};
+
+	FVector TargetLocation{ForceInit};
+
+	// Owned by the async physics tick, counts physics steps instead of frames.
+	int32 SpeedLimitFrameTimeRemaining{0};
+
+	float SpeedLimit{0.0f};
+
+	// Owned by the async physics tick.
+	float PullForce{0.0f};
 };
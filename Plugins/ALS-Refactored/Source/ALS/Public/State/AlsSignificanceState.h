@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Settings/AlsSignificanceSettings.h"
+#include "AlsSignificanceState.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsSignificanceState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	EAlsSignificance Significance{EAlsSignificance::Critical};
+
+	// Distance to the nearest viewer other than the character's own controller.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float ViewerDistance{0.0f};
+
+	// Time accumulated since the last full character update.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float PendingDeltaTime{0.0f};
+
+	// View rotation from the last full character update.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator ViewRotation{ForceInit};
+
+	// View rotation speed from the last full character update, used to extrapolate the view rotation on skipped frames.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator ViewRotationSpeed{ForceInit};
+
+	// Actor yaw speed from the last full character update, used to extrapolate the actor rotation on skipped frames.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "deg/s"))
+	float YawSpeed{0.0f};
+};
@@ -2,6 +2,53 @@
 
 #include "AlsViewState.generated.h"
 
+USTRUCT(BlueprintType)
+struct ALS_API FAlsViewNetworkSmoothingSample
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float ServerTime{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator Rotation{ForceInit};
+};
+
+// Ring buffer of the last received view rotations, evaluated with cubic Hermite interpolation.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsViewNetworkSmoothingBuffer
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	FAlsViewNetworkSmoothingSample Samples[4];
+
+	UPROPERTY(VisibleAnywhere, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 4))
+	int32 SamplesCount{0};
+
+	// Index of the most recent sample in the ring.
+	UPROPERTY(VisibleAnywhere, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 3))
+	int32 LastSampleIndex{0};
+
+public:
+	void Reset();
+
+	// Samples must be added in the order of their server time, a sample with the same time as the last one replaces it.
+	void AddSample(float ServerTime, const FRotator& Rotation);
+
+	// Returns the rotation at the given server time. Before the first sample the first rotation is returned, and after the
+	// last sample the rotation is extrapolated with the last angular velocity for at most the maximum extrapolation time,
+	// after which it returns to the last rotation over the same time.
+	FRotator Evaluate(float ServerTime, float MaxExtrapolationTime) const;
+
+	// Returns the server time after which the evaluated rotation no longer changes until a new sample is added.
+	float GetEndServerTime(float MaxExtrapolationTime) const;
+
+private:
+	// Index 0 is the oldest sample.
+	const FAlsViewNetworkSmoothingSample& GetSample(int32 Index) const;
+};
+
 USTRUCT(BlueprintType)
 struct ALS_API FAlsViewNetworkSmoothingState
 {
@@ -27,6 +74,10 @@ struct ALS_API FAlsViewNetworkSmoothingState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FRotator Rotation{ForceInit};
+
+	// Used only if the network smoothing buffer is enabled in the view settings.
+	UPROPERTY(VisibleAnywhere, Category = "ALS")
+	FAlsViewNetworkSmoothingBuffer Buffer;
 };
 
 USTRUCT(BlueprintType)
@@ -46,3 +97,13 @@ struct ALS_API FAlsViewState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
 	float PreviousYawAngle{0.0f};
 };
+
+inline float FAlsViewNetworkSmoothingBuffer::GetEndServerTime(const float MaxExtrapolationTime) const
+{
+	return SamplesCount > 0 ? Samples[LastSampleIndex].ServerTime + 2.0f * MaxExtrapolationTime : 0.0f;
+}
+
+inline const FAlsViewNetworkSmoothingSample& FAlsViewNetworkSmoothingBuffer::GetSample(const int32 Index) const
+{
+	return Samples[(LastSampleIndex - SamplesCount + 1 + Index + UE_ARRAY_COUNT(Samples)) % UE_ARRAY_COUNT(Samples)];
+}
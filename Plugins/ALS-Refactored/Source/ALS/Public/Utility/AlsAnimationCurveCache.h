@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Utility/AlsMath.h"
+
+class UAnimInstance;
+
+// Resolves a fixed set of animation curve names once, and then reads the values of all these curves from
+// an animation instance in a single pass into a flat array, so that they can be accessed by index.
+struct ALS_API FAlsAnimationCurveCache
+{
+private:
+	TArray<FName> CurveNames;
+
+	// Curve name hashes are calculated once to avoid rehashing on every curve map lookup.
+	TArray<uint32> CurveNameHashes;
+
+	TArray<float> CurveValues;
+
+public:
+	void Initialize(TConstArrayView<FName> NewCurveNames);
+
+	void Refresh(const UAnimInstance* AnimationInstance);
+
+	float GetValue(int32 Index) const;
+
+	float GetValueClamped01(int32 Index) const;
+};
+
+inline float FAlsAnimationCurveCache::GetValue(const int32 Index) const
+{
+	return CurveValues.IsValidIndex(Index) ? CurveValues[Index] : 0.0f;
+}
+
+inline float FAlsAnimationCurveCache::GetValueClamped01(const int32 Index) const
+{
+	return UAlsMath::Clamp01(GetValue(Index));
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <atomic>
+
+#include "Templates/SharedPointer.h"
+#include "UObject/ObjectKey.h"
+
+class UCurveBase;
+class UCurveFloat;
+class UCurveVector;
+struct FRichCurve;
+
+// Uniformly sampled lookup table of a curve asset, evaluated using linear interpolation between samples. If the
+// curve passed to any of the evaluation functions is not the curve from which the table was baked, or the curve
+// could not be baked (for example, if it uses cyclic extrapolation or can't meet the maximum allowed error with
+// the maximum number of samples), then the curve itself is evaluated instead.
+struct ALS_API FAlsBakedCurve
+{
+public:
+	static constexpr auto DefaultMaxSamplesCount{257};
+
+	// Maximum allowed error relative to the value range of each curve channel.
+	static constexpr auto DefaultMaxRelativeError{0.001f};
+
+private:
+	struct FData
+	{
+		// Unlike a raw pointer, the key of a destroyed curve never matches a new curve allocated at the same address.
+		FObjectKey SourceCurve;
+
+		int32 ChannelsCount{0};
+
+		int32 SamplesCount{0};
+
+		float MinTime{0.0f};
+
+		float InverseSampleInterval{0.0f};
+
+		// Maximum absolute error of the baked samples measured against the source curve.
+		float MaxError{0.0f};
+
+		// Samples of all channels interleaved: the sample of the channel C at the index I is located at I * ChannelsCount + C.
+		TArray<float> Samples;
+	};
+
+	// The baked data is immutable and shared between copies, so copying of settings structures stays cheap. Every
+	// published data is kept alive until the baked curve is destroyed, because worker threads may still evaluate the
+	// previous data after a rebake. Curves are only rebaked on load and on edits in the editor, so this doesn't grow.
+	TArray<TSharedRef<const FData, ESPMode::ThreadSafe>> PublishedData;
+
+	std::atomic<const FData*> Data{nullptr};
+
+public:
+	FAlsBakedCurve() = default;
+
+	FAlsBakedCurve(const FAlsBakedCurve& Other);
+
+	FAlsBakedCurve& operator=(const FAlsBakedCurve& Other);
+
+	void Bake(const UCurveFloat* Curve, int32 MaxSamplesCount = DefaultMaxSamplesCount,
+	          float MaxRelativeError = DefaultMaxRelativeError);
+
+	void Bake(const UCurveVector* Curve, int32 MaxSamplesCount = DefaultMaxSamplesCount,
+	          float MaxRelativeError = DefaultMaxRelativeError);
+
+	void Reset();
+
+	bool IsBakedFrom(const UCurveBase* Curve) const;
+
+	int32 GetSamplesCount() const;
+
+	float GetMaxError() const;
+
+	float Evaluate(const UCurveFloat* Curve, float Time) const;
+
+	float Evaluate(const UCurveVector* Curve, int32 Channel, float Time) const;
+
+	FVector Evaluate(const UCurveVector* Curve, float Time) const;
+
+private:
+	void Bake(const UCurveBase* Curve, TConstArrayView<const FRichCurve*> ChannelCurves,
+	          int32 MaxSamplesCount, float MaxRelativeError);
+
+	// Returns the published data if it was baked from the given curve. The data is loaded only once, so that
+	// the check and the evaluation can't see two different versions of the data if the curve is rebaked.
+	const FData* GetDataBakedFrom(const UCurveBase* Curve) const;
+
+	static float EvaluateBaked(const FData& BakedData, int32 Channel, float Time);
+};
+
+inline FAlsBakedCurve::FAlsBakedCurve(const FAlsBakedCurve& Other) : PublishedData{Other.PublishedData},
+                                                                     Data{Other.Data.load(std::memory_order_acquire)} {}
+
+inline FAlsBakedCurve& FAlsBakedCurve::operator=(const FAlsBakedCurve& Other)
+{
+	if (this != &Other)
+	{
+		// Keep the data published by this curve alive, it may still be in use by other threads.
+
+		for (const auto& OtherData : Other.PublishedData)
+		{
+			PublishedData.AddUnique(OtherData);
+		}
+
+		Data.store(Other.Data.load(std::memory_order_acquire), std::memory_order_release);
+	}
+
+	return *this;
+}
+
+inline void FAlsBakedCurve::Reset()
+{
+	Data.store(nullptr, std::memory_order_release);
+}
+
+inline bool FAlsBakedCurve::IsBakedFrom(const UCurveBase* Curve) const
+{
+	return GetDataBakedFrom(Curve) != nullptr;
+}
+
+inline int32 FAlsBakedCurve::GetSamplesCount() const
+{
+	const auto* BakedData{Data.load(std::memory_order_acquire)};
+	return BakedData != nullptr ? BakedData->SamplesCount : 0;
+}
+
+inline float FAlsBakedCurve::GetMaxError() const
+{
+	const auto* BakedData{Data.load(std::memory_order_acquire)};
+	return BakedData != nullptr ? BakedData->MaxError : 0.0f;
+}
+
+inline const FAlsBakedCurve::FData* FAlsBakedCurve::GetDataBakedFrom(const UCurveBase* Curve) const
+{
+	const auto* BakedData{Data.load(std::memory_order_acquire)};
+	return BakedData != nullptr && Curve != nullptr && BakedData->SourceCurve == FObjectKey{Curve} ? BakedData : nullptr;
+}
+
+inline float FAlsBakedCurve::EvaluateBaked(const FData& BakedData, const int32 Channel, const float Time)
+{
+	const auto SamplesCount{BakedData.SamplesCount};
+	const auto ChannelsCount{BakedData.ChannelsCount};
+
+	const auto SamplePosition{FMath::Clamp((Time - BakedData.MinTime) * BakedData.InverseSampleInterval, 0.0f, SamplesCount - 1.0f)};
+	const auto SampleIndex{FMath::Min(FMath::FloorToInt(SamplePosition), SamplesCount - 2)};
+
+	const auto* Sample{BakedData.Samples.GetData() + SampleIndex * ChannelsCount + Channel};
+
+	return FMath::Lerp(Sample[0], Sample[ChannelsCount], SamplePosition - SampleIndex);
+}
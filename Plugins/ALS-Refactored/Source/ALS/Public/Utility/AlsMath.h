@@ -2,6 +2,7 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "State/AlsMovementDirection.h"
+#include "Utility/AlsTrigonometry.h"
 #include "AlsMath.generated.h"
 
 USTRUCT(BlueprintType)
@@ -139,6 +140,26 @@ public:
 	UFUNCTION(BlueprintPure, Category = "ALS|Als Math|Vector", Meta = (AutoCreateRefTerm = "Direction"))
 	static double DirectionToAngleXY(const FVector& Direction);
 
+	// Versions of the direction and angle conversions above with an explicit trigonometry policy, see AlsTrigonometry.h.
+
+	template <typename TrigonometryType>
+	static FVector2D RadianToDirection(float Radian);
+
+	template <typename TrigonometryType>
+	static FVector RadianToDirectionXY(float Radian);
+
+	template <typename TrigonometryType>
+	static FVector2D AngleToDirection(float Angle);
+
+	template <typename TrigonometryType>
+	static FVector AngleToDirectionXY(float Angle);
+
+	template <typename TrigonometryType>
+	static double DirectionToAngle(const FVector2D& Direction);
+
+	template <typename TrigonometryType>
+	static double DirectionToAngleXY(const FVector& Direction);
+
 	UFUNCTION(BlueprintPure, Category = "ALS|Als Math|Vector", Meta = (AutoCreateRefTerm = "Vector"))
 	static FVector PerpendicularClockwiseXY(const FVector& Vector);
 
@@ -344,39 +365,75 @@ inline FVector2D UAlsMath::ClampMagnitude012D(const FVector2D& Vector)
 }
 
 inline FVector2D UAlsMath::RadianToDirection(const float Radian)
+{
+	return RadianToDirection<FAlsExactTrigonometry>(Radian);
+}
+
+inline FVector UAlsMath::RadianToDirectionXY(const float Radian)
+{
+	return RadianToDirectionXY<FAlsExactTrigonometry>(Radian);
+}
+
+inline FVector2D UAlsMath::AngleToDirection(const float Angle)
+{
+	return AngleToDirection<FAlsExactTrigonometry>(Angle);
+}
+
+inline FVector UAlsMath::AngleToDirectionXY(const float Angle)
+{
+	return AngleToDirectionXY<FAlsExactTrigonometry>(Angle);
+}
+
+inline double UAlsMath::DirectionToAngle(const FVector2D& Direction)
+{
+	return DirectionToAngle<FAlsExactTrigonometry>(Direction);
+}
+
+inline double UAlsMath::DirectionToAngleXY(const FVector& Direction)
+{
+	return DirectionToAngleXY<FAlsExactTrigonometry>(Direction);
+}
+
+template <typename TrigonometryType>
+FVector2D UAlsMath::RadianToDirection(const float Radian)
 {
 	float Sin, Cos;
-	FMath::SinCos(&Sin, &Cos, Radian);
+	TrigonometryType::SinCos(Sin, Cos, Radian);
 
 	return {Cos, Sin};
 }
 
-inline FVector UAlsMath::RadianToDirectionXY(const float Radian)
+template <typename TrigonometryType>
+FVector UAlsMath::RadianToDirectionXY(const float Radian)
 {
 	float Sin, Cos;
-	FMath::SinCos(&Sin, &Cos, Radian);
+	TrigonometryType::SinCos(Sin, Cos, Radian);
 
 	return {Cos, Sin, 0.0f};
 }
 
-inline FVector2D UAlsMath::AngleToDirection(const float Angle)
+template <typename TrigonometryType>
+FVector2D UAlsMath::AngleToDirection(const float Angle)
 {
-	return RadianToDirection(FMath::DegreesToRadians(Angle));
+	return RadianToDirection<TrigonometryType>(FMath::DegreesToRadians(Angle));
 }
 
-inline FVector UAlsMath::AngleToDirectionXY(const float Angle)
+template <typename TrigonometryType>
+FVector UAlsMath::AngleToDirectionXY(const float Angle)
 {
-	return RadianToDirectionXY(FMath::DegreesToRadians(Angle));
+	return RadianToDirectionXY<TrigonometryType>(FMath::DegreesToRadians(Angle));
 }
 
-inline double UAlsMath::DirectionToAngle(const FVector2D& Direction)
+template <typename TrigonometryType>
+double UAlsMath::DirectionToAngle(const FVector2D& Direction)
 {
-	return FMath::RadiansToDegrees(FMath::Atan2(Direction.Y, Direction.X));
+	return FMath::RadiansToDegrees(TrigonometryType::Atan2(Direction.Y, Direction.X));
 }
 
-inline double UAlsMath::DirectionToAngleXY(const FVector& Direction)
+template <typename TrigonometryType>
+double UAlsMath::DirectionToAngleXY(const FVector& Direction)
 {
-	return FMath::RadiansToDegrees(FMath::Atan2(Direction.Y, Direction.X));
+	return FMath::RadiansToDegrees(TrigonometryType::Atan2(Direction.Y, Direction.X));
 }
 
 inline FVector UAlsMath::PerpendicularClockwiseXY(const FVector& Vector)
@@ -0,0 +1,104 @@
+﻿#pragma once
+
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Trace/Trace.h"
+#include "UObject/CoreNet.h"
+
+// Low overhead telemetry of the ALS hot paths. Enable the Unreal Insights channel with -trace=Als
+// and the CSV profiler category with -csvCategories=Als. Everything is compiled out in shipping builds.
+
+#define ALS_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if ALS_TRACE_ENABLED
+
+class AActor;
+struct FGameplayTag;
+
+UE_TRACE_CHANNEL_EXTERN(AlsChannel, ALS_API)
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ALS_API, Als);
+
+namespace AlsTrace
+{
+	ALS_API bool IsEnabled();
+
+	ALS_API void TraceStateTransition(const AActor* Actor, const TCHAR* StateName,
+	                                  const FGameplayTag& PreviousTag, const FGameplayTag& NewTag);
+
+	// Returns null if the actor has no net connection.
+	ALS_API UPackageMap* GetPackageMap(const AActor* Actor);
+
+	template <typename ValueType>
+	int64 CalculateNetSerializedBytes(const AActor* Actor, const ValueType& Value);
+}
+
+// Timer of a single update stage, both in the Unreal Insights timing view and in the CSV profiler.
+#define ALS_TRACE_SCOPE(Name) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, AlsChannel) \
+	CSV_SCOPED_TIMING_STAT(Als, Name)
+
+// Per frame accumulated counter, both in the Unreal Insights counters view and in the CSV profiler.
+#define ALS_TRACE_COUNTER_ADD(Name, Value) \
+	do \
+	{ \
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(AlsChannel)) \
+		{ \
+			TRACE_DECLARE_INT_COUNTER(AlsCounter_##Name, TEXT("Als/" #Name)); \
+			TRACE_COUNTER_ADD(AlsCounter_##Name, Value); \
+		} \
+		CSV_CUSTOM_STAT(Als, Name, static_cast<int32>(Value), ECsvCustomStatOp::Accumulate); \
+	} \
+	while (false)
+
+#define ALS_TRACE_STATE_TRANSITION(Actor, StateName, PreviousTag, NewTag) \
+	do \
+	{ \
+		if (AlsTrace::IsEnabled()) \
+		{ \
+			AlsTrace::TraceStateTransition(Actor, TEXT(#StateName), PreviousTag, NewTag); \
+		} \
+	} \
+	while (false)
+
+// Bytes of a value sent by replication or an RPC. The engine serializes values through an archive of an unknown type,
+// so the value is serialized once more into a separate network bit writer, and only while the channel is enabled.
+#define ALS_TRACE_NET_SERIALIZE(Actor, Name, Value) \
+	do \
+	{ \
+		if (AlsTrace::IsEnabled()) \
+		{ \
+			ALS_TRACE_COUNTER_ADD(Name, AlsTrace::CalculateNetSerializedBytes(Actor, Value)); \
+		} \
+	} \
+	while (false)
+
+template <typename ValueType>
+int64 AlsTrace::CalculateNetSerializedBytes(const AActor* Actor, const ValueType& Value)
+{
+	auto* PackageMap{GetPackageMap(Actor)};
+	if (PackageMap == nullptr)
+	{
+		return 0;
+	}
+
+	// NetSerialize() is not const and may normalize the value while saving, so a copy is serialized.
+
+	auto ValueCopy{Value};
+	auto bSuccess{true};
+
+	FNetBitWriter Writer{PackageMap, 0};
+	ValueCopy.NetSerialize(Writer, PackageMap, bSuccess);
+
+	return Writer.GetNumBytes();
+}
+
+#else
+
+#define ALS_TRACE_SCOPE(Name)
+#define ALS_TRACE_COUNTER_ADD(Name, Value)
+#define ALS_TRACE_STATE_TRANSITION(Actor, StateName, PreviousTag, NewTag)
+#define ALS_TRACE_NET_SERIALIZE(Actor, Name, Value)
+
+#endif
@@ -0,0 +1,105 @@
+﻿#pragma once
+
+#include <cmath>
+
+#include "Math/UnrealMathUtility.h"
+
+// Trigonometry policies of the UAlsMath direction and angle conversions. The non-template UAlsMath functions, which are
+// also exposed to blueprints, use FAlsExactTrigonometry. Hot code paths pass FAlsFastTrigonometry explicitly.
+
+struct FAlsExactTrigonometry
+{
+	template <typename ValueType>
+	static ValueType Atan2(ValueType Y, ValueType X);
+
+	static void SinCos(float& Sin, float& Cos, float Radian);
+};
+
+// Minimax polynomial approximations. The maximum error of Atan2() is about 1.8e-5 radians (0.001 degrees), the maximum
+// error of SinCos() is about 8.3e-6, which corresponds to less than 0.0005 degrees of direction error.
+struct FAlsFastTrigonometry
+{
+	template <typename ValueType>
+	static ValueType Atan2(ValueType Y, ValueType X);
+
+	static void SinCos(float& Sin, float& Cos, float Radian);
+};
+
+template <typename ValueType>
+ValueType FAlsExactTrigonometry::Atan2(const ValueType Y, const ValueType X)
+{
+	return FMath::Atan2(Y, X);
+}
+
+inline void FAlsExactTrigonometry::SinCos(float& Sin, float& Cos, const float Radian)
+{
+	FMath::SinCos(&Sin, &Cos, Radian);
+}
+
+template <typename ValueType>
+ValueType FAlsFastTrigonometry::Atan2(const ValueType Y, const ValueType X)
+{
+	const auto AbsoluteX{FMath::Abs(X)};
+	const auto AbsoluteY{FMath::Abs(Y)};
+
+	const auto Max{FMath::Max(AbsoluteX, AbsoluteY)};
+	if (Max <= ValueType{0})
+	{
+		return FAlsExactTrigonometry::Atan2(Y, X);
+	}
+
+	// Approximate atan(T) for T in the [0, 1] range, then extend the result to the whole circle using the octant symmetries.
+
+	const auto T{FMath::Min(AbsoluteX, AbsoluteY) / Max};
+	const auto T2{T * T};
+
+	auto Polynomial{static_cast<ValueType>(2.305950828e-2) * T2 + static_cast<ValueType>(-9.044902151e-2)};
+	Polynomial = Polynomial * T2 + static_cast<ValueType>(1.844899713e-1);
+	Polynomial = Polynomial * T2 + static_cast<ValueType>(-3.316850912e-1);
+
+	auto Result{Polynomial * T2 * T + T};
+
+	if (AbsoluteY > AbsoluteX)
+	{
+		Result = static_cast<ValueType>(UE_DOUBLE_HALF_PI) - Result;
+	}
+
+	if (X < ValueType{0})
+	{
+		Result = static_cast<ValueType>(UE_DOUBLE_PI) - Result;
+	}
+
+	// Use the sign bit instead of a comparison, so that negative zero gives -pi for negative X, same as std::atan2().
+
+	return std::signbit(Y) ? -Result : Result;
+}
+
+inline void FAlsFastTrigonometry::SinCos(float& Sin, float& Cos, const float Radian)
+{
+	// Map the radian to the [-pi, pi] range, then to the [-pi / 2, pi / 2] range using sin(x) = sin(pi - x) and cos(x) = -cos(pi - x).
+
+	auto Value{Radian - UE_TWO_PI * FMath::RoundToFloat(Radian * (0.5f * UE_INV_PI))};
+	auto CosSign{1.0f};
+
+	if (Value > UE_HALF_PI)
+	{
+		Value = UE_PI - Value;
+		CosSign = -1.0f;
+	}
+	else if (Value < -UE_HALF_PI)
+	{
+		Value = -UE_PI - Value;
+		CosSign = -1.0f;
+	}
+
+	const auto Value2{Value * Value};
+
+	auto SinPolynomial{-1.849215600e-4f * Value2 + 8.312365230e-3f};
+	SinPolynomial = SinPolynomial * Value2 - 1.666568098e-1f;
+
+	auto CosPolynomial{-1.275750380e-3f * Value2 + 4.150706101e-2f};
+	CosPolynomial = CosPolynomial * Value2 - 4.999356258e-1f;
+
+	Sin = SinPolynomial * Value2 * Value + Value;
+	Cos = (CosPolynomial * Value2 + 1.0f) * CosSign;
+}
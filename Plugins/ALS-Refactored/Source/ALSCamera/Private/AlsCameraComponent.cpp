@@ -1,6 +1,7 @@
 #include "AlsCameraComponent.h"
 
 #include "AlsCameraSettings.h"
+#include "AlsPhysicsQuerySubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "Animation/AnimInstance.h"
 #include "Components/CapsuleComponent.h"
@@ -8,6 +9,7 @@
 #include "GameFramework/WorldSettings.h"
 #include "Utility/AlsCameraConstants.h"
 #include "Utility/AlsMacros.h"
+#include "Utility/AlsTrace.h"
 #include "Utility/AlsUtility.h"
 
 UAlsCameraComponent::UAlsCameraComponent()
@@ -17,6 +19,28 @@ UAlsCameraComponent::UAlsCameraComponent()
 
 	bTickInEditor = false;
 	bHiddenInGame = true;
+
+	// The order of curve names must match the EAlsCameraCurve enumeration.
+
+	const FName CurveNames[]
+	{
+		UAlsCameraConstants::FirstPersonOverrideCurve(),
+		UAlsCameraConstants::RotationLagCurve(),
+		UAlsCameraConstants::LocationLagXCurve(),
+		UAlsCameraConstants::LocationLagYCurve(),
+		UAlsCameraConstants::LocationLagZCurve(),
+		UAlsCameraConstants::PivotOffsetXCurve(),
+		UAlsCameraConstants::PivotOffsetYCurve(),
+		UAlsCameraConstants::PivotOffsetZCurve(),
+		UAlsCameraConstants::CameraOffsetXCurve(),
+		UAlsCameraConstants::CameraOffsetYCurve(),
+		UAlsCameraConstants::CameraOffsetZCurve(),
+		UAlsCameraConstants::TraceOverrideCurve()
+	};
+
+	static_assert(UE_ARRAY_COUNT(CurveNames) == static_cast<uint8>(EAlsCameraCurve::Count));
+
+	CurveCache.Initialize(CurveNames);
 }
 
 void UAlsCameraComponent::OnRegister()
@@ -112,12 +136,15 @@ void UAlsCameraComponent::GetViewInfo(FMinimalViewInfo& ViewInfo) const
 void UAlsCameraComponent::TickCamera(const float DeltaTime, const bool bAllowLag)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::TickCamera()"), STAT_UAlsCameraComponent_TickCamera, STATGROUP_Als)
+	ALS_TRACE_SCOPE(UAlsCameraComponent_TickCamera)
 
 	if (!IsValid(GetAnimInstance()) || !IsValid(Settings) || !IsValid(Character))
 	{
 		return;
 	}
 
+	CurveCache.Refresh(GetAnimInstance());
+
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebugCameraShapes{UAlsUtility::ShouldDisplayDebug(GetOwner(), UAlsCameraConstants::CameraShapesDisplayName())};
 #else
@@ -132,7 +159,7 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, const bool bAllowLag
 
 	PivotTargetLocation = PivotTargetTransform.GetLocation();
 
-	const auto FirstPersonOverride{UAlsMath::Clamp01(GetAnimInstance()->GetCurveValue(UAlsCameraConstants::FirstPersonOverrideCurve()))};
+	const auto FirstPersonOverride{CurveCache.GetValueClamped01(static_cast<uint8>(EAlsCameraCurve::FirstPersonOverride))};
 	if (FAnimWeight::IsFullWeight(FirstPersonOverride))
 	{
 		PivotLagLocation = PivotTargetLocation;
@@ -210,12 +237,14 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, const bool bAllowLag
 FRotator UAlsCameraComponent::CalculateCameraRotation(const FRotator& CameraTargetRotation,
                                                       const float DeltaTime, const bool bAllowLag) const
 {
+	ALS_TRACE_SCOPE(UAlsCameraComponent_CalculateCameraRotation)
+
 	if (!bAllowLag)
 	{
 		return CameraTargetRotation;
 	}
 
-	const auto RotationLag{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::RotationLagCurve())};
+	const auto RotationLag{CurveCache.GetValue(static_cast<uint8>(EAlsCameraCurve::RotationLag))};
 
 	if (!Settings->bUseLagSubstepping ||
 	    DeltaTime <= Settings->CameraLagSubstepping.LagSubstepDeltaTime ||
@@ -249,6 +278,8 @@ FRotator UAlsCameraComponent::CalculateCameraRotation(const FRotator& CameraTarg
 
 FVector UAlsCameraComponent::CalculatePivotLagLocation(const FQuat& CameraYawRotation, const float DeltaTime, const bool bAllowLag) const
 {
+	ALS_TRACE_SCOPE(UAlsCameraComponent_CalculatePivotLagLocation)
+
 	if (!bAllowLag)
 	{
 		return PivotTargetLocation;
@@ -257,9 +288,9 @@ FVector UAlsCameraComponent::CalculatePivotLagLocation(const FQuat& CameraYawRot
 	const auto RelativePivotInitialLagLocation{CameraYawRotation.UnrotateVector(PivotLagLocation)};
 	const auto RelativePivotTargetLocation{CameraYawRotation.UnrotateVector(PivotTargetLocation)};
 
-	const auto LocationLagX{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagXCurve())};
-	const auto LocationLagY{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagYCurve())};
-	const auto LocationLagZ{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagZCurve())};
+	const auto LocationLagX{CurveCache.GetValue(static_cast<uint8>(EAlsCameraCurve::LocationLagX))};
+	const auto LocationLagY{CurveCache.GetValue(static_cast<uint8>(EAlsCameraCurve::LocationLagY))};
+	const auto LocationLagZ{CurveCache.GetValue(static_cast<uint8>(EAlsCameraCurve::LocationLagZ))};
 
 	// ReSharper disable once CppRedundantParentheses
 	if (!Settings->bUseLagSubstepping ||
@@ -315,9 +346,9 @@ FVector UAlsCameraComponent::CalculatePivotOffset(const FQuat& PivotTargetRotati
 {
 	return PivotTargetRotation.RotateVector(
 		FVector{
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetXCurve()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetYCurve()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetZCurve())
+			CurveCache.GetValue(static_cast<uint8>(EAlsCameraCurve::PivotOffsetX)),
+			CurveCache.GetValue(static_cast<uint8>(EAlsCameraCurve::PivotOffsetY)),
+			CurveCache.GetValue(static_cast<uint8>(EAlsCameraCurve::PivotOffsetZ))
 		} * Character->GetMesh()->GetComponentScale().Z);
 }
 
@@ -325,15 +356,17 @@ FVector UAlsCameraComponent::CalculateCameraOffset() const
 {
 	return CameraRotation.RotateVector(
 		FVector{
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetXCurve()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetYCurve()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetZCurve())
+			CurveCache.GetValue(static_cast<uint8>(EAlsCameraCurve::CameraOffsetX)),
+			CurveCache.GetValue(static_cast<uint8>(EAlsCameraCurve::CameraOffsetY)),
+			CurveCache.GetValue(static_cast<uint8>(EAlsCameraCurve::CameraOffsetZ))
 		} * Character->GetMesh()->GetComponentScale().Z);
 }
 
 FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLocation, const FVector& PivotOffset,
                                                   const float DeltaTime, const bool bAllowLag, float& NewTraceDistanceRatio) const
 {
+	ALS_TRACE_SCOPE(UAlsCameraComponent_CalculateCameraTrace)
+
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebugCameraTraces{UAlsUtility::ShouldDisplayDebug(GetOwner(), UAlsCameraConstants::CameraTracesDisplayName())};
 #else
@@ -348,7 +381,7 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 		FMath::Lerp(
 			GetThirdPersonTraceStartLocation(),
 			PivotTargetLocation + PivotOffset + Settings->ThirdPerson.TraceOverrideOffset,
-			UAlsMath::Clamp01(GetAnimInstance()->GetCurveValue(UAlsCameraConstants::TraceOverrideCurve())))
+			CurveCache.GetValueClamped01(static_cast<uint8>(EAlsCameraCurve::TraceOverride)))
 	};
 
 	const auto TraceEnd{CameraTargetLocation};
@@ -358,6 +391,10 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 
 	auto TraceResult{TraceEnd};
 
+	// Camera traces are never deferred, because reusing an old result can let the camera go through walls.
+
+	UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(GetWorld(), EAlsPhysicsQueryCategory::Camera, EAlsSignificance::Critical, false);
+
 	FHitResult Hit;
 	if (GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, TraceChanel,
 	                                     CollisionShape, {MainTraceTag, false, GetOwner()}))
@@ -370,6 +407,9 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 		{
 			static const FName AdjustedTraceTag{FString::Format(TEXT("{0} (Adjusted Trace)"), {ANSI_TO_TCHAR(__FUNCTION__)})};
 
+			UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(GetWorld(), EAlsPhysicsQueryCategory::Camera,
+			                                                  EAlsSignificance::Critical, false);
+
 			GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, TraceChanel,
 			                                 CollisionShape, {AdjustedTraceTag, false, GetOwner()});
 			if (Hit.IsValidBlockingHit())
@@ -428,6 +468,8 @@ bool UAlsCameraComponent::TryFindBlockingGeometryAdjustedLocation(FVector& Locat
 
 	static const FName OverlapMultiTraceTag{FString::Format(TEXT("{0} (Overlap Multi)"), {ANSI_TO_TCHAR(__FUNCTION__)})};
 
+	UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(GetWorld(), EAlsPhysicsQueryCategory::Camera, EAlsSignificance::Critical, false);
+
 	if (!GetWorld()->OverlapMultiByChannel(Overlaps, Location, FQuat::Identity, TraceChanel,
 	                                       CollisionShape, {OverlapMultiTraceTag, false, GetOwner()}))
 	{
@@ -491,6 +533,8 @@ bool UAlsCameraComponent::TryFindBlockingGeometryAdjustedLocation(FVector& Locat
 
 	static const FName FreeSpaceTraceTag{FString::Format(TEXT("{0} (Free Space Overlap)"), {ANSI_TO_TCHAR(__FUNCTION__)})};
 
+	UAlsPhysicsQuerySubsystem::TryAcquireWorldQueries(GetWorld(), EAlsPhysicsQueryCategory::Camera, EAlsSignificance::Critical, false);
+
 	return !GetWorld()->OverlapBlockingTestByChannel(Location, FQuat::Identity, TraceChanel,
 	                                                 FCollisionShape::MakeSphere(Settings->ThirdPerson.TraceRadius * MeshScale),
 	                                                 {FreeSpaceTraceTag, false, GetOwner()});
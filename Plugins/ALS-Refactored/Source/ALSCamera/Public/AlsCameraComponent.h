@@ -2,12 +2,31 @@
 
 #include "Camera/CameraTypes.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Utility/AlsAnimationCurveCache.h"
 #include "Utility/AlsMath.h"
 #include "AlsCameraComponent.generated.h"
 
 class UAlsCameraSettings;
 class ACharacter;
 
+// Animation curves that are read by the camera on every tick.
+enum class EAlsCameraCurve : uint8
+{
+	FirstPersonOverride,
+	RotationLag,
+	LocationLagX,
+	LocationLagY,
+	LocationLagZ,
+	PivotOffsetX,
+	PivotOffsetY,
+	PivotOffsetZ,
+	CameraOffsetX,
+	CameraOffsetY,
+	CameraOffsetZ,
+	TraceOverride,
+	Count
+};
+
 UCLASS(HideCategories = ("ComponentTick", "Clothing", "Physics", "MasterPoseComponent", "Collision",
 	"AnimationRig", "Lighting", "Deformer", "Rendering", "HLOD", "Navigation", "VirtualTexture", "SkeletalMesh",
 	"Optimization", "LOD", "MaterialParameters", "TextureStreaming", "Mobile", "RayTracing"))
@@ -55,6 +74,8 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	bool bRightShoulder{true};
 
+	FAlsAnimationCurveCache CurveCache;
+
 public:
 	UAlsCameraComponent();
 
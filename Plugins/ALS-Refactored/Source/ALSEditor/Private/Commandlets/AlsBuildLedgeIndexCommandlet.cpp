@@ -0,0 +1,348 @@
+#include "Commandlets/AlsBuildLedgeIndexCommandlet.h"
+
+#include "AlsLedgeIndex.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionActorDesc.h"
+#include "WorldPartition/WorldPartitionHandle.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAlsBuildLedgeIndex, Log, All)
+
+namespace AlsBuildLedgeIndexConstants
+{
+	static constexpr auto DefaultCellSize{200.0f};
+	static constexpr auto DefaultStep{50.0f};
+	static constexpr auto DefaultMinLedgeHeight{50.0f};
+	static constexpr auto DefaultMaxLedgeHeight{250.0f};
+
+	// Distance from the edge sample to the probe location in front of the wall.
+	static constexpr auto ProbeDistance{10.0f};
+
+	// Minimum vertical component of the normal of a surface that can be stood on.
+	static constexpr auto MinWalkableNormalZ{0.71f};
+}
+
+UAlsBuildLedgeIndexCommandlet::UAlsBuildLedgeIndexCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAlsBuildLedgeIndexCommandlet::Main(const FString& Parameters)
+{
+	FString Maps;
+	if (!FParse::Value(*Parameters, TEXT("Map="), Maps, false))
+	{
+		UE_LOG(LogAlsBuildLedgeIndex, Error, TEXT("No maps specified. Use -Map=/Game/Maps/MapA+/Game/Maps/MapB."));
+		return 1;
+	}
+
+	auto CellSize{AlsBuildLedgeIndexConstants::DefaultCellSize};
+	FParse::Value(*Parameters, TEXT("CellSize="), CellSize);
+
+	auto Step{AlsBuildLedgeIndexConstants::DefaultStep};
+	FParse::Value(*Parameters, TEXT("Step="), Step);
+
+	FFloatInterval LedgeHeight{AlsBuildLedgeIndexConstants::DefaultMinLedgeHeight, AlsBuildLedgeIndexConstants::DefaultMaxLedgeHeight};
+	FParse::Value(*Parameters, TEXT("MinHeight="), LedgeHeight.Min);
+	FParse::Value(*Parameters, TEXT("MaxHeight="), LedgeHeight.Max);
+
+	if (CellSize <= 0.0f || Step <= 0.0f || LedgeHeight.Min <= 0.0f || LedgeHeight.Max < LedgeHeight.Min)
+	{
+		UE_LOG(LogAlsBuildLedgeIndex, Error, TEXT("Invalid parameters."));
+		return 1;
+	}
+
+	TArray<FString> MapNames;
+	Maps.ParseIntoArray(MapNames, TEXT("+"));
+
+	auto FailedMapsCount{0};
+
+	for (const auto& MapName : MapNames)
+	{
+		if (!BuildLedgeIndex(MapName, CellSize, Step, LedgeHeight))
+		{
+			FailedMapsCount += 1;
+		}
+	}
+
+	return FailedMapsCount > 0 ? 1 : 0;
+}
+
+bool UAlsBuildLedgeIndexCommandlet::BuildLedgeIndex(const FString& MapName, const float CellSize,
+                                                    const float Step, const FFloatInterval& LedgeHeight)
+{
+	auto* Package{LoadPackage(nullptr, *MapName, LOAD_None)};
+	auto* World{IsValid(Package) ? UWorld::FindWorldInPackage(Package) : nullptr};
+
+	if (!IsValid(World))
+	{
+		UE_LOG(LogAlsBuildLedgeIndex, Error, TEXT("Failed to load map %s."), *MapName);
+		return false;
+	}
+
+	World->WorldType = EWorldType::Editor;
+	World->AddToRoot();
+
+	if (!World->bIsWorldInitialized)
+	{
+		World->InitWorld(UWorld::InitializationValues{}
+		                 .ShouldSimulatePhysics(false)
+		                 .EnableTraceCollision(true)
+		                 .CreateNavigation(false)
+		                 .CreateAISystem(false)
+		                 .AllowAudioPlayback(false)
+		                 .CreatePhysicsScene(true));
+	}
+
+	// Load the whole map, so that ledges spanning several levels or cells are found, and each level gets its own index.
+
+	for (auto* StreamingLevel : World->GetStreamingLevels())
+	{
+		if (IsValid(StreamingLevel))
+		{
+			StreamingLevel->SetShouldBeLoaded(true);
+			StreamingLevel->SetShouldBeVisible(true);
+		}
+	}
+
+	World->FlushLevelStreaming(EFlushLevelStreamingType::Full);
+
+	// World partition cells are not streamed in editor worlds, so reference all external actors instead. They
+	// are loaded into the persistent level, which gets a single index that covers the whole world partition.
+
+	TArray<FWorldPartitionReference> ActorReferences;
+
+	auto* WorldPartition{World->GetWorldPartition()};
+	if (IsValid(WorldPartition))
+	{
+		for (FActorDescList::TIterator<> Iterator{WorldPartition}; Iterator; ++Iterator)
+		{
+			ActorReferences.Emplace(WorldPartition, Iterator->GetGuid());
+		}
+
+		UE_LOG(LogAlsBuildLedgeIndex, Display, TEXT("Loaded %d world partition actors of map %s."), ActorReferences.Num(), *MapName);
+	}
+
+	World->UpdateWorldComponents(true, true);
+
+	auto bSaved{true};
+
+	for (auto* Level : World->GetLevels())
+	{
+		if (IsValid(Level) && !BuildLevelLedgeIndex(Level, CellSize, Step, LedgeHeight))
+		{
+			bSaved = false;
+		}
+	}
+
+	ActorReferences.Reset();
+
+	World->RemoveFromRoot();
+	World->DestroyWorld(false);
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	return bSaved;
+}
+
+bool UAlsBuildLedgeIndexCommandlet::BuildLevelLedgeIndex(ULevel* Level, const float CellSize,
+                                                         const float Step, const FFloatInterval& LedgeHeight)
+{
+	const auto LevelName{Level->GetOutermost()->GetName()};
+
+	AAlsLedgeIndex* LedgeIndex{nullptr};
+
+	for (auto* Actor : Level->Actors)
+	{
+		LedgeIndex = Cast<AAlsLedgeIndex>(Actor);
+		if (IsValid(LedgeIndex))
+		{
+			break;
+		}
+	}
+
+	const auto Bounds{CalculateStaticGeometryBounds(Level)};
+
+	if (!Bounds.IsValid && !IsValid(LedgeIndex))
+	{
+		UE_LOG(LogAlsBuildLedgeIndex, Display, TEXT("Skipped level %s without static geometry."), *LevelName);
+		return true;
+	}
+
+	TArray<FAlsLedge> Ledges;
+
+	if (Bounds.IsValid)
+	{
+		FindLedges(Level, Bounds, Step, LedgeHeight, Ledges);
+	}
+
+	if (!IsValid(LedgeIndex))
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.OverrideLevel = Level;
+
+		LedgeIndex = Level->GetWorld()->SpawnActor<AAlsLedgeIndex>(SpawnParameters);
+	}
+
+	auto bSaved{false};
+
+	if (IsValid(LedgeIndex))
+	{
+		LedgeIndex->Modify();
+		LedgeIndex->Build(Bounds, Ledges, CellSize);
+
+		// Actors of levels that use external actors are saved in their own packages.
+
+		bSaved = SavePackage(Level->GetOutermost(), Level->GetTypedOuter<UWorld>(), FPackageName::GetMapPackageExtension()) &&
+		         (!LedgeIndex->IsPackageExternal() ||
+		          SavePackage(LedgeIndex->GetExternalPackage(), nullptr, FPackageName::GetAssetPackageExtension()));
+	}
+
+	if (bSaved)
+	{
+		UE_LOG(LogAlsBuildLedgeIndex, Display, TEXT("Saved %d ledges to level %s."), Ledges.Num(), *LevelName);
+	}
+	else
+	{
+		UE_LOG(LogAlsBuildLedgeIndex, Error, TEXT("Failed to save ledge index to level %s."), *LevelName);
+	}
+
+	return bSaved;
+}
+
+bool UAlsBuildLedgeIndexCommandlet::SavePackage(UPackage* Package, UObject* Asset, const FString& Extension)
+{
+	Package->MarkPackageDirty();
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Standalone;
+
+	return UPackage::SavePackage(Package, Asset, *FPackageName::LongPackageNameToFilename(Package->GetName(), Extension), SaveArgs);
+}
+
+FBox UAlsBuildLedgeIndexCommandlet::CalculateStaticGeometryBounds(const ULevel* Level)
+{
+	FBox Bounds{ForceInit};
+
+	for (const auto* Actor : Level->Actors)
+	{
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+
+		for (const auto* Component : Actor->GetComponents())
+		{
+			const auto* Primitive{Cast<UPrimitiveComponent>(Component)};
+
+			if (IsValid(Primitive) && Primitive->Mobility == EComponentMobility::Static && Primitive->IsCollisionEnabled() &&
+			    Primitive->GetCollisionObjectType() == ECC_WorldStatic)
+			{
+				Bounds += Primitive->Bounds.GetBox();
+			}
+		}
+	}
+
+	return Bounds;
+}
+
+void UAlsBuildLedgeIndexCommandlet::FindLedges(const ULevel* Level, const FBox& Bounds, const float Step,
+                                               const FFloatInterval& LedgeHeight, TArray<FAlsLedge>& Ledges)
+{
+	const auto* World{Level->GetWorld()};
+
+	static const FName TraceTag{FString::Format(TEXT("{0} (Trace)"), {ANSI_TO_TCHAR(__FUNCTION__)})};
+
+	const FCollisionQueryParams QueryParameters{TraceTag, false};
+	const FCollisionObjectQueryParams ObjectQueryParameters{ECC_WorldStatic};
+
+	static const FVector ProbeDirections[]{{1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}};
+
+	const auto TraceStartZ{Bounds.Max.Z + 1.0f};
+	const auto TraceEndZ{Bounds.Min.Z - 1.0f};
+
+	const auto ProbeOffset{Step * 0.5f + AlsBuildLedgeIndexConstants::ProbeDistance};
+
+	// Sample the walkable tops of the geometry on a grid, then probe the ground in four directions
+	// around each top. A probe that finds a drop within the ledge height range means an edge. The
+	// whole world is traced, but only the tops that belong to the level are indexed, so that each
+	// ledge is saved in the index of the level it will be streamed in with.
+
+	TArray<FHitResult> TopHits;
+
+	for (auto X{Bounds.Min.X}; X <= Bounds.Max.X; X += Step)
+	{
+		for (auto Y{Bounds.Min.Y}; Y <= Bounds.Max.Y; Y += Step)
+		{
+			World->LineTraceMultiByObjectType(TopHits, {X, Y, TraceStartZ}, {X, Y, TraceEndZ}, ObjectQueryParameters, QueryParameters);
+
+			for (const auto& TopHit : TopHits)
+			{
+				const auto* TopActor{TopHit.GetActor()};
+
+				if (TopHit.ImpactNormal.Z < AlsBuildLedgeIndexConstants::MinWalkableNormalZ ||
+				    !IsValid(TopActor) || TopActor->GetLevel() != Level)
+				{
+					continue;
+				}
+
+				for (const auto& ProbeDirection : ProbeDirections)
+				{
+					const auto ProbeLocation{TopHit.ImpactPoint + ProbeDirection * ProbeOffset};
+
+					FHitResult ProbeHit;
+					if (!World->LineTraceSingleByObjectType(ProbeHit, {ProbeLocation.X, ProbeLocation.Y, TopHit.ImpactPoint.Z - 1.0f},
+					                                        {ProbeLocation.X, ProbeLocation.Y, TopHit.ImpactPoint.Z - LedgeHeight.Max},
+					                                        ObjectQueryParameters, QueryParameters) ||
+					    ProbeHit.ImpactNormal.Z < AlsBuildLedgeIndexConstants::MinWalkableNormalZ)
+					{
+						continue;
+					}
+
+					const auto Height{UE_REAL_TO_FLOAT(TopHit.ImpactPoint.Z - ProbeHit.ImpactPoint.Z)};
+					if (!LedgeHeight.Contains(Height))
+					{
+						continue;
+					}
+
+					// Trace back toward the top just below the edge to find the wall and its normal.
+
+					const auto WallTraceZ{TopHit.ImpactPoint.Z - FMath::Min(Height * 0.5f, 10.0f)};
+
+					FHitResult WallHit;
+					if (!World->LineTraceSingleByObjectType(WallHit, {ProbeLocation.X, ProbeLocation.Y, WallTraceZ},
+					                                        {TopHit.ImpactPoint.X, TopHit.ImpactPoint.Y, WallTraceZ},
+					                                        ObjectQueryParameters, QueryParameters) ||
+					    WallHit.bStartPenetrating)
+					{
+						continue;
+					}
+
+					const auto Normal{WallHit.ImpactNormal.GetSafeNormal2D()};
+					if (Normal.IsNearlyZero())
+					{
+						continue;
+					}
+
+					const FVector EdgeLocation{WallHit.ImpactPoint.X, WallHit.ImpactPoint.Y, TopHit.ImpactPoint.Z};
+					const FVector Tangent{-Normal.Y, Normal.X, 0.0f};
+
+					auto& Ledge{Ledges.AddDefaulted_GetRef()};
+					Ledge.Start = EdgeLocation - Tangent * (Step * 0.5f);
+					Ledge.End = EdgeLocation + Tangent * (Step * 0.5f);
+					Ledge.Normal = Normal;
+					Ledge.Height = Height;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,541 @@
+#include "Commandlets/AlsCrowdBenchmarkCommandlet.h"
+
+#include "AlsCharacter.h"
+#include "EngineUtils.h"
+#include "Settings/AlsAnimationInstanceSettings.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerStart.h"
+#include "GameFramework/WorldSettings.h"
+#include "Misc/App.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "UObject/Package.h"
+#include "Utility/AlsGameplayTags.h"
+#include "Utility/AlsTrace.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAlsCrowdBenchmark, Log, All)
+
+namespace AlsCrowdBenchmarkConstants
+{
+	static const TCHAR* DefaultMapName{TEXT("/ALS/ALSExtras/Levels/L_Grid")};
+	static const TCHAR* DefaultCharacterClassName{TEXT("/ALS/ALS/Character/B_Als_Character.B_Als_Character_C")};
+	static const TCHAR* DefaultOutputName{TEXT("AlsCrowdBenchmark")};
+	static const TCHAR* ObstacleMeshName{TEXT("/Engine/BasicShapes/Cube.Cube")};
+
+	static constexpr auto DefaultCharactersCount{100};
+	static constexpr auto DefaultSpacing{300.0f};
+	static constexpr auto DefaultWarmUpFramesCount{60};
+	static constexpr auto DefaultFramesCount{600};
+	static constexpr auto DefaultDeltaTime{1.0f / 30.0f};
+
+	static constexpr auto RandomSeed{0};
+
+	static constexpr auto SignificancesCount{static_cast<int32>(EAlsSignificance::Low) + 1};
+
+	// Moving characters walk in circles, so that they stay around their spawn location.
+	static constexpr auto TurnSpeed{30.0f};
+
+	static constexpr auto JumpInterval{1.5f};
+	static constexpr auto MantlingInterval{1.0f};
+	static constexpr auto RagdollingInterval{4.0f};
+
+	// Mantling characters walk back and forth over a low obstacle placed in front of them.
+	static constexpr auto MantlingTurnInterval{2.0f};
+	static constexpr auto MantlingObstacleDistance{150.0f};
+	static const FVector MantlingObstacleSize{100.0f, 200.0f, 100.0f};
+
+	// The viewer is placed above a corner of the crowd, so that the characters are spread over all significance levels.
+	static constexpr auto ViewerHeight{170.0f};
+}
+
+UAlsCrowdBenchmarkCommandlet::UAlsCrowdBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAlsCrowdBenchmarkCommandlet::Main(const FString& Parameters)
+{
+#if CSV_PROFILER
+	FString MapName{AlsCrowdBenchmarkConstants::DefaultMapName};
+	FParse::Value(*Parameters, TEXT("Map="), MapName);
+
+	FString CharacterClassName{AlsCrowdBenchmarkConstants::DefaultCharacterClassName};
+	FParse::Value(*Parameters, TEXT("Character="), CharacterClassName);
+
+	FString ArchetypesString{TEXT("Idle+Walking+Sprinting+Jumping+Mantling+Ragdolling")};
+	FParse::Value(*Parameters, TEXT("Archetypes="), ArchetypesString, false);
+
+	auto CharactersCount{AlsCrowdBenchmarkConstants::DefaultCharactersCount};
+	FParse::Value(*Parameters, TEXT("Count="), CharactersCount);
+
+	auto Spacing{AlsCrowdBenchmarkConstants::DefaultSpacing};
+	FParse::Value(*Parameters, TEXT("Spacing="), Spacing);
+
+	auto WarmUpFramesCount{AlsCrowdBenchmarkConstants::DefaultWarmUpFramesCount};
+	FParse::Value(*Parameters, TEXT("WarmUpFrames="), WarmUpFramesCount);
+
+	auto FramesCount{AlsCrowdBenchmarkConstants::DefaultFramesCount};
+	FParse::Value(*Parameters, TEXT("Frames="), FramesCount);
+
+	auto DeltaTime{AlsCrowdBenchmarkConstants::DefaultDeltaTime};
+	FParse::Value(*Parameters, TEXT("DeltaTime="), DeltaTime);
+
+	auto bUseAsyncFootIkTraces{false};
+	const auto bOverrideAsyncFootIkTraces{FParse::Bool(*Parameters, TEXT("AsyncFootIkTraces="), bUseAsyncFootIkTraces)};
+
+	FString OutputName{AlsCrowdBenchmarkConstants::DefaultOutputName};
+	FParse::Value(*Parameters, TEXT("Output="), OutputName);
+
+	TArray<EAlsCrowdBenchmarkArchetype> Archetypes;
+
+	if (!ParseArchetypes(ArchetypesString, Archetypes) || CharactersCount <= 0 || Spacing <= 0.0f ||
+	    WarmUpFramesCount < 0 || FramesCount <= 0 || DeltaTime <= 0.0f)
+	{
+		UE_LOG(LogAlsCrowdBenchmark, Error, TEXT("Invalid parameters."));
+		return 1;
+	}
+
+	auto* CharacterClass{LoadClass<AAlsCharacter>(nullptr, *CharacterClassName)};
+	if (!IsValid(CharacterClass))
+	{
+		UE_LOG(LogAlsCrowdBenchmark, Error, TEXT("Failed to load character class %s."), *CharacterClassName);
+		return 1;
+	}
+
+	auto* World{CreateWorld(MapName)};
+	if (!IsValid(World))
+	{
+		UE_LOG(LogAlsCrowdBenchmark, Error, TEXT("Failed to load map %s."), *MapName);
+		return 1;
+	}
+
+	// Make the runs as repeatable as possible: fixed time step, fixed random seeds, fixed spawn
+	// locations and input that depends only on the character index and the frame index.
+
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(DeltaTime);
+
+	FMath::RandInit(AlsCrowdBenchmarkConstants::RandomSeed);
+	FMath::SRandInit(AlsCrowdBenchmarkConstants::RandomSeed);
+
+	// Nothing is rendered with -nullrhi, so the poses of the characters would never be evaluated with the default tick options.
+	// Evaluate them as if all characters were on screen. AAlsCharacter::RefreshVisibilityBasedAnimTickOption() never goes above
+	// the tick option of the class default mesh, so the significance buckets can't override it.
+
+	auto* DefaultMesh{CharacterClass->GetDefaultObject<AAlsCharacter>()->GetMesh()};
+	const auto DefaultTickOption{DefaultMesh->VisibilityBasedAnimTickOption};
+
+	DefaultMesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+
+	TArray<FAlsCrowdBenchmarkCharacter> Characters;
+	SpawnCharacters(World, CharacterClass, Archetypes, CharactersCount, Spacing, Characters);
+
+	UE_LOG(LogAlsCrowdBenchmark, Display, TEXT("Spawned %d characters of %s in map %s."),
+	       Characters.Num(), *CharacterClassName, *MapName);
+
+	// The settings assets are loaded together with the characters. The overridden values are restored after the run.
+
+	TArray<TPair<TWeakObjectPtr<UAlsAnimationInstanceSettings>, bool>> DefaultAsyncFootIkTraces;
+
+	if (bOverrideAsyncFootIkTraces)
+	{
+		for (TObjectIterator<UAlsAnimationInstanceSettings> Iterator; Iterator; ++Iterator)
+		{
+			DefaultAsyncFootIkTraces.Emplace(*Iterator, Iterator->Feet.bUseAsyncIkTraces);
+			Iterator->Feet.bUseAsyncIkTraces = bUseAsyncFootIkTraces;
+		}
+	}
+
+	for (auto i{0}; i < WarmUpFramesCount; i++)
+	{
+		for (const auto& Character : Characters)
+		{
+			ApplyScriptedInput(Character, i, DeltaTime);
+		}
+
+		TickWorld(World, DeltaTime);
+	}
+
+	// Only the ALS category is enabled in addition to the default ones, so the capture contains the timers of the ALS update
+	// stages (character tick, animation game thread and worker thread updates, movement, camera) and the query counters.
+
+	auto* CsvProfiler{FCsvProfiler::Get()};
+	CsvProfiler->EnableCategoryByString(TEXT("Als"));
+
+	CSV_METADATA(TEXT("AlsMap"), *MapName);
+	CSV_METADATA(TEXT("AlsCharacterClass"), *CharacterClassName);
+	CSV_METADATA(TEXT("AlsArchetypes"), *ArchetypesString);
+	CSV_METADATA(TEXT("AlsCharactersCount"), *FString::FromInt(Characters.Num()));
+	CSV_METADATA(TEXT("AlsDeltaTime"), *FString::SanitizeFloat(DeltaTime));
+
+	if (bOverrideAsyncFootIkTraces)
+	{
+		CSV_METADATA(TEXT("AlsAsyncFootIkTraces"), bUseAsyncFootIkTraces ? TEXT("true") : TEXT("false"));
+	}
+
+	CsvProfiler->BeginCapture(-1, FPaths::ProfilingDir() / TEXT("CSV"), OutputName + TEXT(".csv"));
+
+	auto TotalTickTime{0.0};
+
+	int32 TotalSignificanceCounts[AlsCrowdBenchmarkConstants::SignificancesCount]{};
+	auto TotalMantlingFramesCount{0};
+	auto TotalRagdollingFramesCount{0};
+
+	for (auto i{0}; i < FramesCount; i++)
+	{
+		for (const auto& Character : Characters)
+		{
+			ApplyScriptedInput(Character, WarmUpFramesCount + i, DeltaTime);
+		}
+
+		CsvProfiler->BeginFrame();
+
+		TotalTickTime += TickWorld(World, DeltaTime);
+
+		// Record how many characters are in each significance bucket and performing the actions, so
+		// that the capture shows which update paths were actually measured.
+
+		int32 SignificanceCounts[AlsCrowdBenchmarkConstants::SignificancesCount]{};
+		auto MantlingCharactersCount{0};
+		auto RagdollingCharactersCount{0};
+
+		for (const auto& BenchmarkCharacter : Characters)
+		{
+			const auto* Character{BenchmarkCharacter.Character.Get()};
+			if (!IsValid(Character))
+			{
+				continue;
+			}
+
+			SignificanceCounts[static_cast<uint8>(Character->GetSignificanceState().Significance)] += 1;
+			MantlingCharactersCount += Character->GetLocomotionAction() == AlsLocomotionActionTags::Mantling ? 1 : 0;
+			RagdollingCharactersCount += Character->GetLocomotionAction() == AlsLocomotionActionTags::Ragdolling ? 1 : 0;
+		}
+
+		CSV_CUSTOM_STAT(Als, CriticalSignificanceCharacters, SignificanceCounts[0], ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(Als, HighSignificanceCharacters, SignificanceCounts[1], ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(Als, MediumSignificanceCharacters, SignificanceCounts[2], ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(Als, LowSignificanceCharacters, SignificanceCounts[3], ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(Als, MantlingCharacters, MantlingCharactersCount, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(Als, RagdollingCharacters, RagdollingCharactersCount, ECsvCustomStatOp::Set);
+
+		for (auto j{0}; j < AlsCrowdBenchmarkConstants::SignificancesCount; j++)
+		{
+			TotalSignificanceCounts[j] += SignificanceCounts[j];
+		}
+
+		TotalMantlingFramesCount += MantlingCharactersCount;
+		TotalRagdollingFramesCount += RagdollingCharactersCount;
+
+		CsvProfiler->EndFrame();
+	}
+
+	auto CaptureFileName{CsvProfiler->EndCapture()};
+
+	// The capture is stopped and written at the end of the next frame.
+
+	CsvProfiler->BeginFrame();
+	CsvProfiler->EndFrame();
+
+	UE_LOG(LogAlsCrowdBenchmark, Display, TEXT("Ticked %d frames, average world tick time: %.3f ms. Timings written to %s."),
+	       FramesCount, TotalTickTime * 1000.0 / FramesCount, CaptureFileName.IsValid() ? *CaptureFileName.Get() : TEXT("nothing"));
+
+	UE_LOG(LogAlsCrowdBenchmark, Display, TEXT("Average characters per frame: critical %.1f, high %.1f, medium %.1f, low %.1f, ")
+	       TEXT("mantling %.1f, ragdolling %.1f."), static_cast<float>(TotalSignificanceCounts[0]) / FramesCount,
+	       static_cast<float>(TotalSignificanceCounts[1]) / FramesCount, static_cast<float>(TotalSignificanceCounts[2]) / FramesCount,
+	       static_cast<float>(TotalSignificanceCounts[3]) / FramesCount, static_cast<float>(TotalMantlingFramesCount) / FramesCount,
+	       static_cast<float>(TotalRagdollingFramesCount) / FramesCount);
+
+	DestroyWorld(World);
+
+	DefaultMesh->VisibilityBasedAnimTickOption = DefaultTickOption;
+
+	for (const auto& DefaultAsyncFootIkTrace : DefaultAsyncFootIkTraces)
+	{
+		if (DefaultAsyncFootIkTrace.Key.IsValid())
+		{
+			DefaultAsyncFootIkTrace.Key->Feet.bUseAsyncIkTraces = DefaultAsyncFootIkTrace.Value;
+		}
+	}
+
+	return 0;
+#else
+	UE_LOG(LogAlsCrowdBenchmark, Error, TEXT("The CSV profiler is not available in this build configuration."));
+	return 1;
+#endif
+}
+
+bool UAlsCrowdBenchmarkCommandlet::ParseArchetypes(const FString& ArchetypesString, TArray<EAlsCrowdBenchmarkArchetype>& Archetypes)
+{
+	TArray<FString> ArchetypeNames;
+	ArchetypesString.ParseIntoArray(ArchetypeNames, TEXT("+"));
+
+	const auto* ArchetypeEnum{StaticEnum<EAlsCrowdBenchmarkArchetype>()};
+
+	for (const auto& ArchetypeName : ArchetypeNames)
+	{
+		const auto ArchetypeValue{ArchetypeEnum->GetValueByNameString(ArchetypeName)};
+		if (ArchetypeValue == INDEX_NONE)
+		{
+			UE_LOG(LogAlsCrowdBenchmark, Error, TEXT("Unknown archetype %s."), *ArchetypeName);
+			return false;
+		}
+
+		Archetypes.Add(static_cast<EAlsCrowdBenchmarkArchetype>(ArchetypeValue));
+	}
+
+	return Archetypes.Num() > 0;
+}
+
+UWorld* UAlsCrowdBenchmarkCommandlet::CreateWorld(const FString& MapName)
+{
+	auto* Package{LoadPackage(nullptr, *MapName, LOAD_None)};
+	auto* World{IsValid(Package) ? UWorld::FindWorldInPackage(Package) : nullptr};
+
+	if (!IsValid(World))
+	{
+		return nullptr;
+	}
+
+	World->WorldType = EWorldType::Game;
+	World->AddToRoot();
+
+	GEngine->CreateNewWorldContext(EWorldType::Game).SetCurrentWorld(World);
+
+	if (!World->bIsWorldInitialized)
+	{
+		World->InitWorld(UWorld::InitializationValues{}
+		                 .ShouldSimulatePhysics(true)
+		                 .EnableTraceCollision(true)
+		                 .CreateNavigation(false)
+		                 .CreateAISystem(false)
+		                 .AllowAudioPlayback(false)
+		                 .CreatePhysicsScene(true));
+	}
+
+	World->InitializeActorsForPlay(FURL{});
+	World->BeginPlay();
+
+	// There is no game mode to start the play, so do it directly.
+
+	if (!World->HasBegunPlay())
+	{
+		World->GetWorldSettings()->NotifyBeginPlay();
+	}
+
+	return World;
+}
+
+void UAlsCrowdBenchmarkCommandlet::DestroyWorld(UWorld* World)
+{
+	GEngine->DestroyWorldContext(World);
+
+	World->RemoveFromRoot();
+	World->DestroyWorld(false);
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+void UAlsCrowdBenchmarkCommandlet::SpawnCharacters(UWorld* World, UClass* CharacterClass,
+                                                   const TArray<EAlsCrowdBenchmarkArchetype>& Archetypes,
+                                                   const int32 CharactersCount, const float Spacing,
+                                                   TArray<FAlsCrowdBenchmarkCharacter>& Characters)
+{
+	// Place the characters on a square grid around the first player start, or around the world origin if there is none.
+
+	FVector Origin{0.0f, 0.0f, 100.0f};
+
+	for (TActorIterator<APlayerStart> Iterator{World}; Iterator; ++Iterator)
+	{
+		Origin = Iterator->GetActorLocation();
+		break;
+	}
+
+	const auto GridSize{FMath::CeilToInt(FMath::Sqrt(static_cast<float>(CharactersCount)))};
+	const auto GridOffset{(GridSize - 1) * Spacing * 0.5f};
+
+	// Without a viewer, all characters that are not performing an action would have the lowest significance.
+
+	World->SpawnActor<APlayerController>(FVector{Origin.X - GridOffset, Origin.Y - GridOffset,
+	                                             Origin.Z + AlsCrowdBenchmarkConstants::ViewerHeight}, FRotator::ZeroRotator);
+
+	auto* ObstacleMesh{LoadObject<UStaticMesh>(nullptr, AlsCrowdBenchmarkConstants::ObstacleMeshName)};
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	Characters.Reset(CharactersCount);
+
+	for (auto i{0}; i < CharactersCount; i++)
+	{
+		const FVector Location{
+			Origin.X + (i % GridSize) * Spacing - GridOffset,
+			Origin.Y + (i / GridSize) * Spacing - GridOffset,
+			Origin.Z
+		};
+
+		const auto YawAngle{FRotator::NormalizeAxis(i * 137.0f)};
+
+		auto* Character{World->SpawnActor<AAlsCharacter>(CharacterClass, Location, {0.0f, YawAngle, 0.0f}, SpawnParameters)};
+		if (!IsValid(Character))
+		{
+			continue;
+		}
+
+		if (!IsValid(Character->GetController()))
+		{
+			Character->SpawnDefaultController();
+		}
+
+		auto& BenchmarkCharacter{Characters.AddDefaulted_GetRef()};
+		BenchmarkCharacter.Character = Character;
+		BenchmarkCharacter.Archetype = Archetypes[i % Archetypes.Num()];
+		BenchmarkCharacter.InitialYawAngle = YawAngle;
+
+		if (BenchmarkCharacter.Archetype == EAlsCrowdBenchmarkArchetype::Mantling && IsValid(ObstacleMesh))
+		{
+			SpawnMantlingObstacle(World, ObstacleMesh, *Character);
+		}
+	}
+}
+
+void UAlsCrowdBenchmarkCommandlet::SpawnMantlingObstacle(UWorld* World, UStaticMesh* ObstacleMesh, const AAlsCharacter& Character)
+{
+	// Place the obstacle on the floor in front of the character, the mesh is expected to be a 1 m cube centered at its origin.
+
+	const auto CharacterLocation{Character.GetActorLocation()};
+	const auto ObstacleLocation{
+		CharacterLocation + Character.GetActorForwardVector() * AlsCrowdBenchmarkConstants::MantlingObstacleDistance
+	};
+
+	auto FloorZ{CharacterLocation.Z - Character.GetSimpleCollisionHalfHeight()};
+
+	FHitResult FloorHit;
+	if (World->LineTraceSingleByObjectType(FloorHit, ObstacleLocation, {ObstacleLocation.X, ObstacleLocation.Y, FloorZ - 1000.0f},
+	                                       FCollisionObjectQueryParams{ECC_WorldStatic}))
+	{
+		FloorZ = FloorHit.ImpactPoint.Z;
+	}
+
+	const FTransform ObstacleTransform{
+		Character.GetActorRotation(),
+		{ObstacleLocation.X, ObstacleLocation.Y, FloorZ + AlsCrowdBenchmarkConstants::MantlingObstacleSize.Z * 0.5f},
+		AlsCrowdBenchmarkConstants::MantlingObstacleSize / 100.0f
+	};
+
+	auto* Obstacle{World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), ObstacleTransform)};
+	if (IsValid(Obstacle))
+	{
+		Obstacle->GetStaticMeshComponent()->SetStaticMesh(ObstacleMesh);
+	}
+}
+
+void UAlsCrowdBenchmarkCommandlet::ApplyScriptedInput(const FAlsCrowdBenchmarkCharacter& BenchmarkCharacter,
+                                                      const int32 FrameIndex, const float DeltaTime)
+{
+	auto* Character{BenchmarkCharacter.Character.Get()};
+	if (!IsValid(Character) || BenchmarkCharacter.Archetype == EAlsCrowdBenchmarkArchetype::Idle)
+	{
+		return;
+	}
+
+	const auto IsIntervalStart{
+		[FrameIndex, DeltaTime](const float Interval)
+		{
+			const auto IntervalFramesCount{FMath::Max(1, FMath::RoundToInt(Interval / DeltaTime))};
+			return FrameIndex % IntervalFramesCount == 0;
+		}
+	};
+
+	if (BenchmarkCharacter.Archetype == EAlsCrowdBenchmarkArchetype::Ragdolling)
+	{
+		if (IsIntervalStart(AlsCrowdBenchmarkConstants::RagdollingInterval))
+		{
+			if (Character->GetLocomotionAction() == AlsLocomotionActionTags::Ragdolling)
+			{
+				Character->TryStopRagdolling();
+			}
+			else
+			{
+				Character->StartRagdolling();
+			}
+		}
+
+		return;
+	}
+
+	auto YawAngle{BenchmarkCharacter.InitialYawAngle + FrameIndex * DeltaTime * AlsCrowdBenchmarkConstants::TurnSpeed};
+
+	if (BenchmarkCharacter.Archetype == EAlsCrowdBenchmarkArchetype::Mantling)
+	{
+		const auto TurnIntervalFramesCount{
+			FMath::Max(1, FMath::RoundToInt(AlsCrowdBenchmarkConstants::MantlingTurnInterval / DeltaTime))
+		};
+
+		YawAngle = BenchmarkCharacter.InitialYawAngle + (FrameIndex / TurnIntervalFramesCount % 2 == 0 ? 0.0f : 180.0f);
+	}
+
+	const FRotator Rotation{0.0f, FRotator::NormalizeAxis(YawAngle), 0.0f};
+
+	auto* Controller{Character->GetController()};
+	if (IsValid(Controller))
+	{
+		Controller->SetControlRotation(Rotation);
+	}
+
+	Character->SetDesiredGait(BenchmarkCharacter.Archetype == EAlsCrowdBenchmarkArchetype::Sprinting
+		                          ? AlsGaitTags::Sprinting
+		                          : AlsGaitTags::Walking);
+
+	Character->AddMovementInput(Rotation.Vector());
+
+	switch (BenchmarkCharacter.Archetype)
+	{
+		case EAlsCrowdBenchmarkArchetype::Jumping:
+			if (IsIntervalStart(AlsCrowdBenchmarkConstants::JumpInterval))
+			{
+				Character->Jump();
+			}
+			else
+			{
+				Character->StopJumping();
+			}
+			break;
+
+		case EAlsCrowdBenchmarkArchetype::Mantling:
+			if (IsIntervalStart(AlsCrowdBenchmarkConstants::MantlingInterval))
+			{
+				Character->TryStartMantlingGrounded();
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+double UAlsCrowdBenchmarkCommandlet::TickWorld(UWorld* World, const float DeltaTime)
+{
+	GFrameCounter += 1;
+
+	FApp::SetDeltaTime(DeltaTime);
+	FApp::SetCurrentTime(FApp::GetCurrentTime() + DeltaTime);
+
+	const auto StartTime{FPlatformTime::Seconds()};
+
+	World->Tick(LEVELTICK_All, DeltaTime);
+
+	FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+
+	return FPlatformTime::Seconds() - StartTime;
+}
@@ -1,5 +1,8 @@
 #include "Nodes/AlsAnimGraphNode_CurvesBlend.h"
 
+#include "AnimGraphNode_SequencePlayer.h"
+#include "Kismet2/CompilerResultsLog.h"
+
 #define LOCTEXT_NAMESPACE "AlsCurvesBlendAnimationGraphNode"
 
 FText UAlsAnimGraphNode_CurvesBlend::GetNodeTitle(const ENodeTitleType::Type TitleType) const
@@ -17,4 +20,27 @@ FString UAlsAnimGraphNode_CurvesBlend::GetNodeCategory() const
 	return TEXT("ALS");
 }
 
+void UAlsAnimGraphNode_CurvesBlend::ValidateAnimNodeDuringCompilation(USkeleton* Skeleton, FCompilerResultsLog& MessageLog)
+{
+	Super::ValidateAnimNodeDuringCompilation(Skeleton, MessageLog);
+
+	if (!Node.bEvaluateCurvesOnly)
+	{
+		return;
+	}
+
+	// Curves only evaluation is supported only for a sequence player directly linked to the curves pose.
+
+	const auto* CurvesPin{FindPin(GET_MEMBER_NAME_CHECKED(FAlsAnimNode_CurvesBlend, CurvesPose), EGPD_Input)};
+
+	if (CurvesPin != nullptr && CurvesPin->LinkedTo.Num() > 0 &&
+	    !IsValid(Cast<UAnimGraphNode_SequencePlayer>(CurvesPin->LinkedTo[0]->GetOwningNode())))
+	{
+		MessageLog.Warning(*LOCTEXT("CurvesOnlyUnsupportedWarning",
+		                            "@@ evaluates curves only when the curves pose is directly linked to a sequence player."
+		                            " The linked @@ will be fully evaluated.").ToString(),
+		                   this, CurvesPin->LinkedTo[0]->GetOwningNode());
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -16,6 +16,10 @@ void UAlsAnimGraphNode_GameplayTagsBlend::PostEditChangeProperty(FPropertyChange
 	{
 		ReconstructNode();
 	}
+	else if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(FAlsAnimNode_GameplayTagsBlend, bUseInertialBlend))
+	{
+		Node.RefreshTransitionType();
+	}
 
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 }
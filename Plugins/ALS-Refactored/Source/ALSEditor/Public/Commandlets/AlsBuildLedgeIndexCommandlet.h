@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "AlsBuildLedgeIndexCommandlet.generated.h"
+
+class ULevel;
+struct FAlsLedge;
+
+// Finds the mantleable ledges of the static geometry of the given maps and saves them into an AlsLedgeIndex actor
+// placed in each level of each map. All streaming levels and world partition actors are loaded first. Usage:
+// -run=AlsBuildLedgeIndex -Map=/Game/Maps/MapA+/Game/Maps/MapB [-CellSize=200] [-Step=50] [-MinHeight=50] [-MaxHeight=250]
+UCLASS()
+class ALSEDITOR_API UAlsBuildLedgeIndexCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAlsBuildLedgeIndexCommandlet();
+
+	virtual int32 Main(const FString& Parameters) override;
+
+private:
+	static bool BuildLedgeIndex(const FString& MapName, float CellSize, float Step, const FFloatInterval& LedgeHeight);
+
+	static bool BuildLevelLedgeIndex(ULevel* Level, float CellSize, float Step, const FFloatInterval& LedgeHeight);
+
+	static bool SavePackage(UPackage* Package, UObject* Asset, const FString& Extension);
+
+	static FBox CalculateStaticGeometryBounds(const ULevel* Level);
+
+	static void FindLedges(const ULevel* Level, const FBox& Bounds, float Step, const FFloatInterval& LedgeHeight,
+	                       TArray<FAlsLedge>& Ledges);
+};
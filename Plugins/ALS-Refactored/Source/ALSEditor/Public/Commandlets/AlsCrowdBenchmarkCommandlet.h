@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "AlsCrowdBenchmarkCommandlet.generated.h"
+
+class AAlsCharacter;
+class UStaticMesh;
+class UWorld;
+
+UENUM()
+enum class EAlsCrowdBenchmarkArchetype : uint8
+{
+	Idle,
+	Walking,
+	Sprinting,
+	Jumping,
+	Mantling,
+	Ragdolling
+};
+
+struct FAlsCrowdBenchmarkCharacter
+{
+	TWeakObjectPtr<AAlsCharacter> Character;
+
+	EAlsCrowdBenchmarkArchetype Archetype{EAlsCrowdBenchmarkArchetype::Idle};
+
+	float InitialYawAngle{0.0f};
+};
+
+// Spawns a crowd of ALS characters driven by scripted input in the given map, ticks the world with a fixed delta time for
+// a fixed number of frames and writes the per frame timings of the ALS update stages and the physics query counts into a
+// CSV file. The archetypes are assigned to the characters in turn. A viewer is placed above a corner of the crowd, so that
+// the characters are spread over the significance buckets, and the per frame bucket sizes are written into the CSV file
+// too. Poses are evaluated for all characters as if they were on screen. Mantling characters get an obstacle to mantle.
+// -AsyncFootIkTraces overrides the asynchronous foot IK traces setting of all animation instance settings for the run. Usage:
+// -run=AlsCrowdBenchmark -nullrhi [-Map=/ALS/ALSExtras/Levels/L_Grid] [-Character=/ALS/ALS/Character/B_Als_Character.B_Als_Character_C]
+// [-Archetypes=Idle+Walking+Sprinting+Jumping+Mantling+Ragdolling] [-Count=100] [-Spacing=300]
+// [-WarmUpFrames=60] [-Frames=600] [-DeltaTime=0.0333] [-AsyncFootIkTraces=true|false] [-Output=AlsCrowdBenchmark]
+UCLASS()
+class ALSEDITOR_API UAlsCrowdBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAlsCrowdBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Parameters) override;
+
+private:
+	static bool ParseArchetypes(const FString& ArchetypesString, TArray<EAlsCrowdBenchmarkArchetype>& Archetypes);
+
+	static UWorld* CreateWorld(const FString& MapName);
+
+	static void DestroyWorld(UWorld* World);
+
+	static void SpawnCharacters(UWorld* World, UClass* CharacterClass, const TArray<EAlsCrowdBenchmarkArchetype>& Archetypes,
+	                            int32 CharactersCount, float Spacing, TArray<FAlsCrowdBenchmarkCharacter>& Characters);
+
+	static void SpawnMantlingObstacle(UWorld* World, UStaticMesh* ObstacleMesh, const AAlsCharacter& Character);
+
+	static void ApplyScriptedInput(const FAlsCrowdBenchmarkCharacter& BenchmarkCharacter, int32 FrameIndex, float DeltaTime);
+
+	static double TickWorld(UWorld* World, float DeltaTime);
+};
@@ -19,4 +19,6 @@ public:
 	virtual FText GetTooltipText() const override;
 
 	virtual FString GetNodeCategory() const override;
+
+	virtual void ValidateAnimNodeDuringCompilation(USkeleton* Skeleton, FCompilerResultsLog& MessageLog) override;
 };